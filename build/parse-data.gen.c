@@ -0,0 +1,480 @@
+const char binary_parse_data[] = {
+  0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61,
+  0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x03,
+  0x65, 0x6e, 0x76, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c,
+  0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0b,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01,
+  0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c,
+  0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01,
+  0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c,
+  0x65, 0x74, 0x01, 0x04, 0x01, 0x2b, 0x01, 0x04, 0x01, 0x2a, 0x01, 0x04,
+  0x06, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74, 0x01, 0x04, 0x05, 0x73, 0x70,
+  0x6c, 0x69, 0x74, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01,
+  0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x6e,
+  0x73, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x04, 0x04, 0x63, 0x74,
+  0x6f, 0x72, 0x01, 0x04, 0x08, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x73, 0x79,
+  0x6d, 0x01, 0x04, 0x09, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e,
+  0x67, 0x01, 0x04, 0x0f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x69,
+  0x6e, 0x64, 0x65, 0x78, 0x2d, 0x6f, 0x66, 0x01, 0x04, 0x0b, 0x73, 0x74,
+  0x72, 0x69, 0x6e, 0x67, 0x2d, 0x73, 0x70, 0x61, 0x6e, 0x01, 0x04, 0x0d,
+  0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x74, 0x6f, 0x2d, 0x69, 0x6e,
+  0x74, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d,
+  0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x6e, 0x69,
+  0x6c, 0x3f, 0x01, 0x04, 0x01, 0x76, 0x00, 0x01, 0x01, 0x04, 0x03, 0x65,
+  0x71, 0x3f, 0x01, 0x01, 0x04, 0x04, 0x63, 0x74, 0x6f, 0x72, 0x01, 0x04,
+  0x01, 0x76, 0x00, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65,
+  0x01, 0x04, 0x03, 0x4e, 0x69, 0x6c, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+  0x04, 0x05, 0x63, 0x6f, 0x6e, 0x73, 0x3f, 0x01, 0x04, 0x01, 0x76, 0x00,
+  0x01, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x01, 0x04, 0x04, 0x63,
+  0x74, 0x6f, 0x72, 0x01, 0x04, 0x01, 0x76, 0x00, 0x01, 0x01, 0x04, 0x05,
+  0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x6e, 0x73,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x04, 0x73, 0x79, 0x6d, 0x3f,
+  0x01, 0x04, 0x01, 0x76, 0x00, 0x01, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f,
+  0x01, 0x01, 0x04, 0x04, 0x63, 0x74, 0x6f, 0x72, 0x01, 0x04, 0x01, 0x76,
+  0x00, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04,
+  0x06, 0x53, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x04, 0x02, 0x6f, 0x72, 0x01, 0x04, 0x01, 0x61, 0x01, 0x04, 0x01,
+  0x62, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x04, 0x01, 0x61,
+  0x01, 0x06, 0x01, 0x04, 0x01, 0x62, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04,
+  0x03, 0x6e, 0x6f, 0x74, 0x01, 0x04, 0x01, 0x61, 0x00, 0x01, 0x01, 0x04,
+  0x02, 0x69, 0x66, 0x01, 0x04, 0x01, 0x61, 0x01, 0x07, 0x01, 0x06, 0x00,
+  0x00, 0x01, 0x01, 0x01, 0x04, 0x02, 0x6c, 0x70, 0x01, 0x04, 0x03, 0x76,
+  0x61, 0x6c, 0x01, 0x04, 0x04, 0x66, 0x75, 0x6e, 0x63, 0x00, 0x01, 0x01,
+  0x04, 0x04, 0x66, 0x75, 0x6e, 0x63, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69,
+  0x72, 0x73, 0x74, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x00, 0x01, 0x01,
+  0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x07, 0x63, 0x6f, 0x6e, 0x73,
+  0x75, 0x6d, 0x65, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x04, 0x04,
+  0x66, 0x75, 0x6e, 0x63, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01,
+  0x01, 0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72,
+  0x01, 0x02, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x66, 0x75, 0x6e, 0x63,
+  0x01, 0x02, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c,
+  0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01,
+  0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c,
+  0x65, 0x74, 0x01, 0x04, 0x05, 0x70, 0x61, 0x72, 0x74, 0x73, 0x00, 0x01,
+  0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61,
+  0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01,
+  0x04, 0x01, 0x73, 0x00, 0x01, 0x01, 0x04, 0x04, 0x66, 0x75, 0x6e, 0x63,
+  0x01, 0x04, 0x02, 0x63, 0x68, 0x01, 0x04, 0x01, 0x73, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d,
+  0x6c, 0x65, 0x74, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74,
+  0x01, 0x04, 0x05, 0x70, 0x61, 0x72, 0x74, 0x73, 0x00, 0x01, 0x01, 0x04,
+  0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65,
+  0x73, 0x74, 0x01, 0x04, 0x05, 0x70, 0x61, 0x72, 0x74, 0x73, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x01, 0x04, 0x05, 0x73,
+  0x70, 0x6c, 0x69, 0x74, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x03,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x0c, 0x73,
+  0x6b, 0x69, 0x70, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x01,
+  0x04, 0x03, 0x73, 0x74, 0x72, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65,
+  0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01,
+  0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65,
+  0x74, 0x01, 0x04, 0x03, 0x65, 0x6e, 0x64, 0x00, 0x01, 0x01, 0x04, 0x02,
+  0x69, 0x66, 0x01, 0x01, 0x04, 0x04, 0x6e, 0x69, 0x6c, 0x3f, 0x01, 0x04,
+  0x03, 0x65, 0x6e, 0x64, 0x00, 0x01, 0x02, 0x00, 0x01, 0x01, 0x04, 0x09,
+  0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x01, 0x04, 0x03,
+  0x73, 0x74, 0x72, 0x01, 0x01, 0x04, 0x01, 0x2b, 0x01, 0x04, 0x03, 0x65,
+  0x6e, 0x64, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65,
+  0x74, 0x01, 0x01, 0x04, 0x0f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d,
+  0x69, 0x6e, 0x64, 0x65, 0x78, 0x2d, 0x6f, 0x66, 0x01, 0x04, 0x03, 0x73,
+  0x74, 0x72, 0x01, 0x02, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x04, 0x0f, 0x73, 0x6b, 0x69, 0x70, 0x2d, 0x77, 0x68, 0x69, 0x74,
+  0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72,
+  0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62,
+  0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0b, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x04, 0x03, 0x73,
+  0x74, 0x72, 0x00, 0x01, 0x01, 0x04, 0x07, 0x63, 0x6f, 0x6e, 0x73, 0x75,
+  0x6d, 0x65, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x01, 0x04, 0x0a,
+  0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01,
+  0x01, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d,
+  0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01,
+  0x04, 0x01, 0x73, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01,
+  0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01, 0x02,
+  0x01, 0x3b, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61,
+  0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0b, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x04,
+  0x01, 0x73, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04,
+  0x03, 0x65, 0x71, 0x3f, 0x01, 0x04, 0x01, 0x73, 0x01, 0x02, 0x00, 0x00,
+  0x01, 0x02, 0x00, 0x01, 0x01, 0x04, 0x0f, 0x73, 0x6b, 0x69, 0x70, 0x2d,
+  0x77, 0x68, 0x69, 0x74, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x01, 0x04,
+  0x01, 0x73, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0b, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x01, 0x04,
+  0x0c, 0x73, 0x6b, 0x69, 0x70, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e,
+  0x74, 0x01, 0x04, 0x01, 0x73, 0x00, 0x00, 0x00, 0x01, 0x04, 0x03, 0x73,
+  0x74, 0x72, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x01, 0x04, 0x09, 0x73, 0x75, 0x62,
+  0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72,
+  0x01, 0x01, 0x04, 0x0b, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x73,
+  0x70, 0x61, 0x6e, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x02, 0x02,
+  0x20, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x06,
+  0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x00, 0x01, 0x02, 0x0a, 0x30, 0x31,
+  0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x00, 0x01, 0x01, 0x01,
+  0x04, 0x07, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x73, 0x00, 0x01, 0x02,
+  0x39, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
+  0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+  0x78, 0x79, 0x7a, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+  0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
+  0x56, 0x57, 0x58, 0x59, 0x5a, 0x3f, 0x2b, 0x2d, 0x2a, 0x2f, 0x00, 0x01,
+  0x01, 0x01, 0x04, 0x07, 0x63, 0x68, 0x61, 0x72, 0x2d, 0x69, 0x6e, 0x01,
+  0x04, 0x02, 0x63, 0x68, 0x01, 0x04, 0x03, 0x73, 0x65, 0x74, 0x00, 0x01,
+  0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f,
+  0x01, 0x04, 0x02, 0x63, 0x68, 0x01, 0x02, 0x00, 0x00, 0x01, 0x07, 0x01,
+  0x01, 0x04, 0x03, 0x6e, 0x6f, 0x74, 0x01, 0x01, 0x04, 0x04, 0x6e, 0x69,
+  0x6c, 0x3f, 0x01, 0x01, 0x04, 0x0f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+  0x2d, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2d, 0x6f, 0x66, 0x01, 0x04, 0x03,
+  0x73, 0x65, 0x74, 0x01, 0x04, 0x02, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x01, 0x04, 0x07, 0x69, 0x73, 0x64, 0x69, 0x67, 0x69,
+  0x74, 0x01, 0x04, 0x02, 0x63, 0x68, 0x00, 0x01, 0x01, 0x04, 0x07, 0x63,
+  0x68, 0x61, 0x72, 0x2d, 0x69, 0x6e, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01,
+  0x01, 0x04, 0x06, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x04, 0x08, 0x69, 0x73, 0x6c, 0x65, 0x74, 0x74, 0x65,
+  0x72, 0x01, 0x04, 0x02, 0x63, 0x68, 0x00, 0x01, 0x01, 0x04, 0x07, 0x63,
+  0x68, 0x61, 0x72, 0x2d, 0x69, 0x6e, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01,
+  0x01, 0x04, 0x07, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x73, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x01, 0x04, 0x09, 0x74, 0x61, 0x6b, 0x65, 0x2d, 0x73,
+  0x70, 0x61, 0x6e, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x04, 0x03,
+  0x73, 0x65, 0x74, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e,
+  0x75, 0x65, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61,
+  0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0b, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x04,
+  0x03, 0x65, 0x6e, 0x64, 0x00, 0x01, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e,
+  0x74, 0x69, 0x6e, 0x75, 0x65, 0x01, 0x01, 0x04, 0x09, 0x73, 0x75, 0x62,
+  0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72,
+  0x01, 0x03, 0x00, 0x01, 0x04, 0x03, 0x65, 0x6e, 0x64, 0x00, 0x01, 0x01,
+  0x04, 0x09, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x01,
+  0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x04, 0x03, 0x65, 0x6e, 0x64, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x01, 0x04, 0x0b, 0x73, 0x74,
+  0x72, 0x69, 0x6e, 0x67, 0x2d, 0x73, 0x70, 0x61, 0x6e, 0x01, 0x04, 0x03,
+  0x73, 0x74, 0x72, 0x01, 0x04, 0x03, 0x73, 0x65, 0x74, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x01, 0x04, 0x0d, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2d,
+  0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x01, 0x04, 0x03, 0x73, 0x74,
+  0x72, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65,
+  0x00, 0x01, 0x01, 0x04, 0x09, 0x74, 0x61, 0x6b, 0x65, 0x2d, 0x73, 0x70,
+  0x61, 0x6e, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x01, 0x04, 0x06,
+  0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c,
+  0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01,
+  0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c,
+  0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x06, 0x64, 0x69, 0x67, 0x69,
+  0x74, 0x73, 0x01, 0x04, 0x01, 0x73, 0x00, 0x01, 0x01, 0x04, 0x08, 0x63,
+  0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x01, 0x01, 0x04, 0x0d, 0x73,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x74, 0x6f, 0x2d, 0x69, 0x6e, 0x74,
+  0x01, 0x04, 0x06, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x00, 0x01, 0x04,
+  0x01, 0x73, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x01, 0x04, 0x06, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70,
+  0x01, 0x04, 0x03, 0x6b, 0x65, 0x79, 0x01, 0x04, 0x03, 0x6d, 0x61, 0x70,
+  0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x04, 0x6e,
+  0x69, 0x6c, 0x3f, 0x01, 0x04, 0x03, 0x6d, 0x61, 0x70, 0x00, 0x01, 0x01,
+  0x04, 0x05, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x01, 0x02, 0x0d, 0x6c, 0x6f,
+  0x6f, 0x6b, 0x75, 0x70, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x00,
+  0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x03, 0x65, 0x71,
+  0x3f, 0x01, 0x04, 0x03, 0x6b, 0x65, 0x79, 0x01, 0x01, 0x04, 0x05, 0x66,
+  0x69, 0x72, 0x73, 0x74, 0x01, 0x04, 0x03, 0x6d, 0x61, 0x70, 0x00, 0x00,
+  0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01, 0x01, 0x04,
+  0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04, 0x03, 0x6d, 0x61, 0x70, 0x00,
+  0x00, 0x01, 0x01, 0x04, 0x06, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x01,
+  0x04, 0x03, 0x6b, 0x65, 0x79, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x01,
+  0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04, 0x03, 0x6d, 0x61, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x0c,
+  0x70, 0x61, 0x72, 0x73, 0x65, 0x2d, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c,
+  0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e,
+  0x74, 0x69, 0x6e, 0x75, 0x65, 0x00, 0x01, 0x01, 0x04, 0x09, 0x74, 0x61,
+  0x6b, 0x65, 0x2d, 0x73, 0x70, 0x61, 0x6e, 0x01, 0x04, 0x03, 0x73, 0x74,
+  0x72, 0x01, 0x01, 0x04, 0x07, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x73,
+  0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62,
+  0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01,
+  0x04, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x01, 0x04, 0x01, 0x73, 0x00, 0x01,
+  0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x01,
+  0x01, 0x04, 0x08, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x73, 0x79, 0x6d, 0x01,
+  0x04, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x01, 0x04, 0x01, 0x73, 0x00,
+  0x00, 0x00, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+  0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x04, 0x0a, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2d, 0x62, 0x6f, 0x6f,
+  0x6c, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x04, 0x08, 0x63, 0x6f,
+  0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x00, 0x01, 0x01, 0x04, 0x07, 0x63,
+  0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x65, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72,
+  0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64,
+  0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04,
+  0x02, 0x63, 0x68, 0x01, 0x04, 0x01, 0x73, 0x00, 0x01, 0x01, 0x04, 0x02,
+  0x69, 0x66, 0x01, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x04, 0x02,
+  0x63, 0x68, 0x01, 0x02, 0x01, 0x74, 0x00, 0x01, 0x01, 0x04, 0x08, 0x63,
+  0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x01, 0x06, 0x01, 0x04, 0x01,
+  0x73, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x03,
+  0x65, 0x71, 0x3f, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01, 0x02, 0x01, 0x66,
+  0x00, 0x01, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75,
+  0x65, 0x01, 0x07, 0x01, 0x04, 0x01, 0x73, 0x00, 0x01, 0x01, 0x04, 0x06,
+  0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74, 0x01, 0x02, 0x12, 0x3c, 0x70, 0x61,
+  0x72, 0x73, 0x65, 0x2d, 0x62, 0x6f, 0x6f, 0x6c, 0x2d, 0x65, 0x72, 0x72,
+  0x6f, 0x72, 0x3a, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01, 0x02, 0x01, 0x3e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x01, 0x04, 0x14, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2d,
+  0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x65, 0x73, 0x63, 0x61, 0x70,
+  0x65, 0x64, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x01, 0x04, 0x03, 0x73,
+  0x74, 0x72, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75,
+  0x65, 0x00, 0x01, 0x01, 0x04, 0x07, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d,
+  0x65, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x01, 0x04, 0x0a, 0x6c,
+  0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01,
+  0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c,
+  0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01, 0x04,
+  0x01, 0x73, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04,
+  0x03, 0x65, 0x71, 0x3f, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01, 0x02, 0x01,
+  0x22, 0x00, 0x01, 0x01, 0x04, 0x0c, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2d,
+  0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x01, 0x01, 0x04, 0x06, 0x63, 0x6f,
+  0x6e, 0x63, 0x61, 0x74, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x01, 0x02,
+  0x01, 0x22, 0x00, 0x01, 0x04, 0x01, 0x73, 0x01, 0x04, 0x08, 0x63, 0x6f,
+  0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69,
+  0x66, 0x01, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x04, 0x02, 0x63,
+  0x68, 0x01, 0x02, 0x01, 0x5c, 0x00, 0x01, 0x01, 0x04, 0x0c, 0x70, 0x61,
+  0x72, 0x73, 0x65, 0x2d, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x01, 0x01,
+  0x04, 0x06, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74, 0x01, 0x04, 0x03, 0x76,
+  0x61, 0x6c, 0x01, 0x02, 0x01, 0x5c, 0x00, 0x01, 0x04, 0x01, 0x73, 0x01,
+  0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x00, 0x01,
+  0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f,
+  0x01, 0x04, 0x02, 0x63, 0x68, 0x01, 0x02, 0x01, 0x6e, 0x00, 0x01, 0x01,
+  0x04, 0x0c, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2d, 0x73, 0x74, 0x72, 0x69,
+  0x6e, 0x67, 0x01, 0x01, 0x04, 0x06, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74,
+  0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x01, 0x02, 0x01, 0x0a, 0x00, 0x01,
+  0x04, 0x01, 0x73, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e,
+  0x75, 0x65, 0x00, 0x01, 0x01, 0x04, 0x05, 0x65, 0x72, 0x72, 0x6f, 0x72,
+  0x01, 0x02, 0x0d, 0x3c, 0x62, 0x61, 0x64, 0x2d, 0x65, 0x73, 0x63, 0x61,
+  0x70, 0x65, 0x3e, 0x3a, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01, 0x02, 0x04,
+  0x2c, 0x69, 0x6e, 0x3a, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x04, 0x0c, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2d, 0x73,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x01,
+  0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74,
+  0x69, 0x6e, 0x75, 0x65, 0x00, 0x01, 0x01, 0x04, 0x07, 0x63, 0x6f, 0x6e,
+  0x73, 0x75, 0x6d, 0x65, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x01,
+  0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73,
+  0x01, 0x01, 0x01, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x02, 0x63,
+  0x68, 0x01, 0x04, 0x01, 0x73, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66,
+  0x01, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x04, 0x02, 0x63, 0x68,
+  0x01, 0x02, 0x01, 0x5c, 0x00, 0x01, 0x01, 0x04, 0x14, 0x70, 0x61, 0x72,
+  0x73, 0x65, 0x2d, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x65, 0x73,
+  0x63, 0x61, 0x70, 0x65, 0x64, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x01,
+  0x04, 0x01, 0x73, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e,
+  0x75, 0x65, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04,
+  0x03, 0x65, 0x71, 0x3f, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01, 0x02, 0x01,
+  0x22, 0x00, 0x01, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e,
+  0x75, 0x65, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x01, 0x04, 0x01, 0x73,
+  0x00, 0x01, 0x01, 0x04, 0x0c, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2d, 0x73,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x01, 0x01, 0x04, 0x06, 0x63, 0x6f, 0x6e,
+  0x63, 0x61, 0x74, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x01, 0x04, 0x02,
+  0x63, 0x68, 0x00, 0x01, 0x04, 0x01, 0x73, 0x01, 0x04, 0x08, 0x63, 0x6f,
+  0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61,
+  0x6d, 0x62, 0x64, 0x61, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x0a,
+  0x70, 0x61, 0x72, 0x73, 0x65, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x01, 0x04,
+  0x03, 0x73, 0x74, 0x72, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74, 0x69,
+  0x6e, 0x75, 0x65, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c,
+  0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0b,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01,
+  0x04, 0x03, 0x73, 0x74, 0x72, 0x00, 0x01, 0x01, 0x04, 0x07, 0x63, 0x6f,
+  0x6e, 0x73, 0x75, 0x6d, 0x65, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01,
+  0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61,
+  0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x02,
+  0x63, 0x68, 0x01, 0x04, 0x01, 0x73, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69,
+  0x66, 0x01, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x04, 0x02, 0x63,
+  0x68, 0x01, 0x02, 0x01, 0x29, 0x00, 0x01, 0x01, 0x04, 0x08, 0x63, 0x6f,
+  0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x01, 0x00, 0x01, 0x04, 0x01, 0x73,
+  0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x03, 0x65,
+  0x71, 0x3f, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01, 0x02, 0x01, 0x2e, 0x00,
+  0x01, 0x01, 0x04, 0x0b, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2d, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x01, 0x04, 0x01, 0x73, 0x01, 0x01, 0x04, 0x0a, 0x6c,
+  0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01,
+  0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c,
+  0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x01, 0x76, 0x01, 0x04, 0x01,
+  0x73, 0x00, 0x01, 0x01, 0x04, 0x07, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d,
+  0x65, 0x01, 0x04, 0x01, 0x73, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74,
+  0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04,
+  0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d,
+  0x62, 0x64, 0x61, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01, 0x04, 0x01, 0x73,
+  0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x03, 0x65,
+  0x71, 0x3f, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01, 0x02, 0x01, 0x29, 0x00,
+  0x01, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65,
+  0x01, 0x04, 0x01, 0x76, 0x01, 0x04, 0x01, 0x73, 0x00, 0x01, 0x01, 0x04,
+  0x09, 0x64, 0x6f, 0x74, 0x2d, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x01, 0x04,
+  0x03, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0e, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64,
+  0x61, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x00,
+  0x01, 0x01, 0x04, 0x0b, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2d, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x01, 0x04,
+  0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01,
+  0x01, 0x01, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+  0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x01, 0x66, 0x01,
+  0x04, 0x01, 0x73, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x70, 0x61, 0x72, 0x73,
+  0x65, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x01, 0x04, 0x01, 0x73, 0x01, 0x01,
+  0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73,
+  0x01, 0x01, 0x01, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x01, 0x72,
+  0x01, 0x04, 0x01, 0x73, 0x00, 0x01, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e,
+  0x74, 0x69, 0x6e, 0x75, 0x65, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x6e,
+  0x73, 0x01, 0x04, 0x01, 0x66, 0x01, 0x04, 0x01, 0x72, 0x00, 0x01, 0x04,
+  0x01, 0x73, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+  0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d,
+  0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65,
+  0x74, 0x01, 0x01, 0x04, 0x0f, 0x73, 0x6b, 0x69, 0x70, 0x2d, 0x77, 0x68,
+  0x69, 0x74, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x01, 0x04, 0x03, 0x73,
+  0x74, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x0b, 0x70,
+  0x61, 0x72, 0x73, 0x65, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x01, 0x04,
+  0x03, 0x73, 0x74, 0x72, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74, 0x69,
+  0x6e, 0x75, 0x65, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c,
+  0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0b,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01,
+  0x04, 0x03, 0x73, 0x74, 0x72, 0x00, 0x01, 0x01, 0x04, 0x07, 0x63, 0x6f,
+  0x6e, 0x73, 0x75, 0x6d, 0x65, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01,
+  0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61,
+  0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x02,
+  0x63, 0x68, 0x01, 0x04, 0x01, 0x73, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69,
+  0x66, 0x01, 0x01, 0x04, 0x07, 0x69, 0x73, 0x64, 0x69, 0x67, 0x69, 0x74,
+  0x01, 0x04, 0x02, 0x63, 0x68, 0x00, 0x01, 0x01, 0x04, 0x0d, 0x70, 0x61,
+  0x72, 0x73, 0x65, 0x2d, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x01,
+  0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74,
+  0x69, 0x6e, 0x75, 0x65, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01,
+  0x01, 0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01,
+  0x02, 0x01, 0x28, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x70, 0x61, 0x72, 0x73,
+  0x65, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x01, 0x04, 0x01, 0x73, 0x01, 0x04,
+  0x08, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x00, 0x01, 0x01,
+  0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x08, 0x69, 0x73, 0x6c, 0x65,
+  0x74, 0x74, 0x65, 0x72, 0x01, 0x04, 0x02, 0x63, 0x68, 0x00, 0x01, 0x01,
+  0x04, 0x0c, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2d, 0x73, 0x79, 0x6d, 0x62,
+  0x6f, 0x6c, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x04, 0x08, 0x63,
+  0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x00, 0x01, 0x01, 0x04, 0x02,
+  0x69, 0x66, 0x01, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x04, 0x02,
+  0x63, 0x68, 0x01, 0x02, 0x01, 0x23, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x70,
+  0x61, 0x72, 0x73, 0x65, 0x2d, 0x62, 0x6f, 0x6f, 0x6c, 0x01, 0x04, 0x01,
+  0x73, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65,
+  0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x03, 0x65,
+  0x71, 0x3f, 0x01, 0x04, 0x02, 0x63, 0x68, 0x01, 0x02, 0x01, 0x22, 0x00,
+  0x01, 0x01, 0x04, 0x0c, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2d, 0x73, 0x74,
+  0x72, 0x69, 0x6e, 0x67, 0x01, 0x02, 0x00, 0x01, 0x04, 0x01, 0x73, 0x01,
+  0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x00, 0x01,
+  0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f,
+  0x01, 0x04, 0x02, 0x63, 0x68, 0x01, 0x02, 0x01, 0x27, 0x00, 0x01, 0x01,
+  0x04, 0x0b, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2d, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x01, 0x04, 0x01, 0x73, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74,
+  0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04,
+  0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d,
+  0x62, 0x64, 0x61, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x01, 0x04, 0x03,
+  0x73, 0x74, 0x72, 0x00, 0x01, 0x01, 0x04, 0x08, 0x63, 0x6f, 0x6e, 0x74,
+  0x69, 0x6e, 0x75, 0x65, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x6e, 0x73,
+  0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x05,
+  0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f,
+  0x6e, 0x73, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0e,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62,
+  0x64, 0x61, 0x00, 0x00, 0x01, 0x01, 0x04, 0x05, 0x65, 0x72, 0x72, 0x6f,
+  0x72, 0x01, 0x02, 0x0e, 0x3c, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2d, 0x65,
+  0x72, 0x72, 0x6f, 0x72, 0x3e, 0x3a, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0e,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62,
+  0x64, 0x61, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0b, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x01, 0x04,
+  0x0f, 0x73, 0x6b, 0x69, 0x70, 0x2d, 0x77, 0x68, 0x69, 0x74, 0x65, 0x73,
+  0x70, 0x61, 0x63, 0x65, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x05, 0x70, 0x61, 0x72, 0x73, 0x65,
+  0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x04, 0x09, 0x6d, 0x75, 0x6c,
+  0x74, 0x69, 0x65, 0x78, 0x70, 0x72, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69,
+  0x66, 0x01, 0x04, 0x09, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x65, 0x78, 0x70,
+  0x72, 0x01, 0x01, 0x04, 0x0b, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2d, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x01,
+  0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73,
+  0x01, 0x01, 0x01, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x03, 0x76,
+  0x61, 0x6c, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x00, 0x01, 0x01, 0x04,
+  0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01,
+  0x01, 0x01, 0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+  0x2d, 0x6c, 0x65, 0x74, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x00, 0x01,
+  0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f,
+  0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x02, 0x00, 0x00, 0x01, 0x01,
+  0x04, 0x04, 0x63, 0x6f, 0x6e, 0x73, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x6e, 0x73, 0x01,
+  0x04, 0x03, 0x76, 0x61, 0x6c, 0x01, 0x01, 0x04, 0x05, 0x70, 0x61, 0x72,
+  0x73, 0x65, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72, 0x01, 0x04, 0x09, 0x6d,
+  0x75, 0x6c, 0x74, 0x69, 0x65, 0x78, 0x70, 0x72, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+  0x2d, 0x6c, 0x65, 0x74, 0x01, 0x01, 0x04, 0x0f, 0x73, 0x6b, 0x69, 0x70,
+  0x2d, 0x77, 0x68, 0x69, 0x74, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x01,
+  0x04, 0x03, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04,
+  0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d,
+  0x62, 0x64, 0x61, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0b, 0x70, 0x61, 0x72,
+  0x73, 0x65, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x01, 0x04, 0x03, 0x73,
+  0x74, 0x72, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d,
+  0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0e, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61,
+  0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x01, 0x04, 0x03, 0x73, 0x74, 0x72,
+  0x00, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x01, 0x04, 0x0e,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62,
+  0x64, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c,
+  0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01,
+  0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c,
+  0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x08, 0x73, 0x79, 0x6d, 0x2d,
+  0x6e, 0x61, 0x6d, 0x65, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01,
+  0x01, 0x05, 0x08, 0x69, 0x73, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x01,
+  0x04, 0x08, 0x73, 0x79, 0x6d, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x01, 0x01,
+  0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x05, 0x70, 0x61,
+  0x72, 0x73, 0x65, 0x00, 0x00, 0x01, 0x04, 0x05, 0x70, 0x61, 0x72, 0x73,
+  0x65, 0x01, 0x01, 0x04, 0x05, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x01, 0x04,
+  0x08, 0x73, 0x79, 0x6d, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d,
+  0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65,
+  0x74, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x01, 0x01, 0x04,
+  0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x01, 0x2b, 0x00, 0x00,
+  0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x01, 0x01, 0x04, 0x05,
+  0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x01, 0x2a, 0x00, 0x00, 0x01,
+  0x01, 0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x01, 0x01, 0x04, 0x05, 0x71,
+  0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x06, 0x63, 0x6f, 0x6e, 0x63, 0x61,
+  0x74, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x01,
+  0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x05, 0x73,
+  0x70, 0x6c, 0x69, 0x74, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f,
+  0x72, 0x65, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01,
+  0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x00, 0x00, 0x01, 0x01, 0x04,
+  0x04, 0x63, 0x6f, 0x72, 0x65, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f,
+  0x74, 0x65, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x00, 0x00, 0x01,
+  0x01, 0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x01, 0x01, 0x04, 0x05, 0x71,
+  0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+  0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x01, 0x01, 0x04,
+  0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f,
+  0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x01, 0x01,
+  0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x04, 0x63, 0x74,
+  0x6f, 0x72, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x72, 0x65,
+  0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x08,
+  0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x73, 0x79, 0x6d, 0x00, 0x00, 0x01, 0x01,
+  0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75,
+  0x6f, 0x74, 0x65, 0x01, 0x04, 0x09, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72,
+  0x69, 0x6e, 0x67, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x72,
+  0x65, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04,
+  0x0f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x69, 0x6e, 0x64, 0x65,
+  0x78, 0x2d, 0x6f, 0x66, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f,
+  0x72, 0x65, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01,
+  0x04, 0x0b, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x73, 0x70, 0x61,
+  0x6e, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x01,
+  0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x0d, 0x73,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x74, 0x6f, 0x2d, 0x69, 0x6e, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0b, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x01, 0x04,
+  0x03, 0x65, 0x6e, 0x76, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74,
+  0x65, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+  0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00
+};
@@ -0,0 +1,381 @@
+// Compiled by mylisp --compile-c from test/native/compiled.ss; build with
+//   clang++ -std=c++11 -fPIC -shared -I<mylisp>/src -o <name>.so <this file>
+// and load as native/<name>.
+
+#include "compiled.h"
+
+static Value f4_slow_fib(VM& vm, Value self, const Value* args, size_t n);
+static Value f5_count_up(VM& vm, Value self, const Value* args, size_t n);
+static Value f6_even_(VM& vm, Value self, const Value* args, size_t n);
+static Value f7_odd_(VM& vm, Value self, const Value* args, size_t n);
+static Value f8_sum(VM& vm, Value self, const Value* args, size_t n);
+static Value f9_sum_rest(VM& vm, Value self, const Value* args, size_t n);
+static Value f11_current_lambda(VM& vm, Value self, const Value* args, size_t n);
+static Value f10_adder(VM& vm, Value self, const Value* args, size_t n);
+static Value f12_greet(VM& vm, Value self, const Value* args, size_t n);
+static Value f13_quoted(VM& vm, Value self, const Value* args, size_t n);
+static Value f14_current_lambda(VM& vm, Value self, const Value* args, size_t n);
+static Value f3_current_let(VM& vm, Value self, const Value* args, size_t n);
+static Value f2_current_let(VM& vm, Value self, const Value* args, size_t n);
+static Value f1_current_lambda(VM& vm, Value self, const Value* args, size_t n);
+static Value f0_module(VM& vm, Value self, const Value* args, size_t n);
+
+static Value f4_slow_fib(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  const Value* k = self->as_compiled.constants;
+  Value v21_n;
+  VM_EXPECT(vm, n == 1);
+  v21_n = args[0];
+  Value t0[] = {v21_n, k[0]};
+  Value t1 = apply(vm, c[0], t0, 2);
+  if(t1.asBool(vm)) {
+    return k[0];
+  } else {
+    Value t2[] = {v21_n, k[1]};
+    Value t3 = apply(vm, c[0], t2, 2);
+    if(t3.asBool(vm)) {
+      return k[1];
+    } else {
+      Value t4[] = {v21_n, k[1]};
+      Value t5 = apply(vm, c[3], t4, 2);
+      Value t6[] = {t5};
+      Value t7 = apply(vm, c[2], t6, 1);
+      Value t8[] = {v21_n, k[2]};
+      Value t9 = apply(vm, c[3], t8, 2);
+      Value t10[] = {t9};
+      Value t11 = apply(vm, c[2], t10, 1);
+      Value t12[] = {t7, t11};
+      return compiled_tail_call(vm, c[1], t12, 2);
+    }
+  }
+}
+
+static Value f5_count_up(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  const Value* k = self->as_compiled.constants;
+  Value v22_i;
+  Value v23_n;
+  Value loop[2];
+top:
+  VM_EXPECT(vm, n == 2);
+  v22_i = args[0];
+  v23_n = args[1];
+  Value t13[] = {v22_i, v23_n};
+  Value t14 = apply(vm, c[0], t13, 2);
+  if(t14.asBool(vm)) {
+    return v22_i;
+  } else {
+    Value t15[] = {v22_i, k[1]};
+    Value t16 = apply(vm, c[2], t15, 2);
+    loop[0] = t16;
+    loop[1] = v23_n;
+    args = loop;
+    n = 2;
+    goto top;
+  }
+}
+
+static Value f6_even_(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  const Value* k = self->as_compiled.constants;
+  Value v24_n;
+  VM_EXPECT(vm, n == 1);
+  v24_n = args[0];
+  Value t17[] = {v24_n, k[0]};
+  Value t18 = apply(vm, c[0], t17, 2);
+  if(t18.asBool(vm)) {
+    return vm.true_;
+  } else {
+    Value t19[] = {v24_n, k[1]};
+    Value t20 = apply(vm, c[2], t19, 2);
+    Value t21[] = {t20};
+    return compiled_tail_call(vm, c[1], t21, 1);
+  }
+}
+
+static Value f7_odd_(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  const Value* k = self->as_compiled.constants;
+  Value v25_n;
+  VM_EXPECT(vm, n == 1);
+  v25_n = args[0];
+  Value t22[] = {v25_n, k[0]};
+  Value t23 = apply(vm, c[0], t22, 2);
+  if(t23.asBool(vm)) {
+    return vm.false_;
+  } else {
+    Value t24[] = {v25_n, k[1]};
+    Value t25 = apply(vm, c[2], t24, 2);
+    Value t26[] = {t25};
+    return compiled_tail_call(vm, c[1], t26, 1);
+  }
+}
+
+static Value f8_sum(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  const Value* k = self->as_compiled.constants;
+  Value v26_items;
+  v26_items = compiled_rest(vm, args, n, 0);
+  Value t27[] = {v26_items};
+  Value t28 = apply(vm, c[1], t27, 1);
+  Value t29[] = {t28, k[3]};
+  Value t30 = apply(vm, c[0], t29, 2);
+  if(t30.asBool(vm)) {
+    return k[0];
+  } else {
+    Value t31[] = {v26_items};
+    Value t32 = apply(vm, c[3], t31, 1);
+    Value t33[] = {v26_items};
+    Value t34 = apply(vm, c[4], t33, 1);
+    Value t35[] = {t32, t34};
+    return compiled_tail_call(vm, c[2], t35, 2);
+  }
+}
+
+static Value f9_sum_rest(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  Value v27_item;
+  Value v28_items;
+  VM_EXPECT(vm, n == 2);
+  v27_item = args[0];
+  v28_items = args[1];
+  std::vector<Value> t36 = {};
+  compiled_spread(vm, t36, v28_items);
+  Value t37 = apply(vm, c[1], t36.data(), t36.size());
+  Value t38[] = {v27_item, t37};
+  return compiled_tail_call(vm, c[0], t38, 2);
+}
+
+static Value f11_current_lambda(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  Value v31_x;
+  VM_EXPECT(vm, n == 1);
+  v31_x = args[0];
+  Value t39[] = {v31_x, c[1]};
+  return compiled_tail_call(vm, c[0], t39, 2);
+}
+
+static Value f10_adder(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  const Value* k = self->as_compiled.constants;
+  Value v29_n;
+  VM_EXPECT(vm, n == 1);
+  v29_n = args[0];
+  Value v30_current_lambda;
+  v30_current_lambda = make_compiled(vm, "current-lambda", f11_current_lambda, 2, k);
+  v30_current_lambda->as_compiled.captured[0] = c[0];
+  v30_current_lambda->as_compiled.captured[1] = v29_n;
+  return v30_current_lambda;
+}
+
+static Value f12_greet(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  const Value* k = self->as_compiled.constants;
+  Value v32_name;
+  VM_EXPECT(vm, n == 1);
+  v32_name = args[0];
+  Value t40[] = {k[4], v32_name, k[5]};
+  return compiled_tail_call(vm, c[0], t40, 3);
+}
+
+static Value f13_quoted(VM& vm, Value self, const Value* args, size_t n) {
+  const Value* k = self->as_compiled.constants;
+  VM_EXPECT(vm, n == 0);
+  return k[6];
+}
+
+static Value f14_current_lambda(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  const Value* k = self->as_compiled.constants;
+  Value v34_sym_name;
+  VM_EXPECT(vm, n == 1);
+  v34_sym_name = args[0];
+  Value t41[] = {v34_sym_name, k[8]};
+  Value t42 = builtin_func(k[7])(vm, t41, 2);
+  if(t42.asBool(vm)) {
+    return c[0];
+  } else {
+    Value t43[] = {v34_sym_name, k[9]};
+    Value t44 = builtin_func(k[7])(vm, t43, 2);
+    if(t44.asBool(vm)) {
+      return c[1];
+    } else {
+      Value t45[] = {v34_sym_name, k[10]};
+      Value t46 = builtin_func(k[7])(vm, t45, 2);
+      if(t46.asBool(vm)) {
+        return c[2];
+      } else {
+        Value t47[] = {v34_sym_name, k[11]};
+        Value t48 = builtin_func(k[7])(vm, t47, 2);
+        if(t48.asBool(vm)) {
+          return c[3];
+        } else {
+          Value t49[] = {v34_sym_name, k[12]};
+          Value t50 = builtin_func(k[7])(vm, t49, 2);
+          if(t50.asBool(vm)) {
+            return c[4];
+          } else {
+            Value t51[] = {v34_sym_name, k[13]};
+            Value t52 = builtin_func(k[7])(vm, t51, 2);
+            if(t52.asBool(vm)) {
+              return c[5];
+            } else {
+              Value t53[] = {v34_sym_name, k[14]};
+              Value t54 = builtin_func(k[7])(vm, t53, 2);
+              if(t54.asBool(vm)) {
+                return c[6];
+              } else {
+                Value t55 = compiled_unbound(vm, "error");
+                Value t56[] = {v34_sym_name};
+                return compiled_tail_call(vm, t55, t56, 1);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+static Value f3_current_let(VM& vm, Value self, const Value* args, size_t n) {
+  const Value* k = self->as_compiled.constants;
+  Value v5__;
+  Value v6__;
+  Value v7_eq_;
+  Value v8_ctor;
+  Value v9_concat;
+  Value v10_first;
+  Value v11_rest;
+  VM_EXPECT(vm, n == 7);
+  v5__ = args[0];
+  v6__ = args[1];
+  v7_eq_ = args[2];
+  v8_ctor = args[3];
+  v9_concat = args[4];
+  v10_first = args[5];
+  v11_rest = args[6];
+  Value v12_slow_fib;
+  Value v13_count_up;
+  Value v14_even_;
+  Value v15_odd_;
+  Value v16_sum;
+  Value v17_sum_rest;
+  Value v18_adder;
+  Value v19_greet;
+  Value v20_quoted;
+  v12_slow_fib = make_compiled(vm, "slow-fib", f4_slow_fib, 4, k);
+  v13_count_up = make_compiled(vm, "count-up", f5_count_up, 3, k);
+  v14_even_ = make_compiled(vm, "even\?", f6_even_, 3, k);
+  v15_odd_ = make_compiled(vm, "odd\?", f7_odd_, 3, k);
+  v16_sum = make_compiled(vm, "sum", f8_sum, 5, k);
+  v17_sum_rest = make_compiled(vm, "sum-rest", f9_sum_rest, 2, k);
+  v18_adder = make_compiled(vm, "adder", f10_adder, 1, k);
+  v19_greet = make_compiled(vm, "greet", f12_greet, 1, k);
+  v20_quoted = make_compiled(vm, "quoted", f13_quoted, 0, k);
+  v12_slow_fib->as_compiled.captured[0] = v7_eq_;
+  v12_slow_fib->as_compiled.captured[1] = v5__;
+  v12_slow_fib->as_compiled.captured[2] = v12_slow_fib;
+  v12_slow_fib->as_compiled.captured[3] = v6__;
+  v13_count_up->as_compiled.captured[0] = v7_eq_;
+  v13_count_up->as_compiled.captured[1] = v13_count_up;
+  v13_count_up->as_compiled.captured[2] = v5__;
+  v14_even_->as_compiled.captured[0] = v7_eq_;
+  v14_even_->as_compiled.captured[1] = v15_odd_;
+  v14_even_->as_compiled.captured[2] = v6__;
+  v15_odd_->as_compiled.captured[0] = v7_eq_;
+  v15_odd_->as_compiled.captured[1] = v14_even_;
+  v15_odd_->as_compiled.captured[2] = v6__;
+  v16_sum->as_compiled.captured[0] = v7_eq_;
+  v16_sum->as_compiled.captured[1] = v8_ctor;
+  v16_sum->as_compiled.captured[2] = v17_sum_rest;
+  v16_sum->as_compiled.captured[3] = v10_first;
+  v16_sum->as_compiled.captured[4] = v11_rest;
+  v17_sum_rest->as_compiled.captured[0] = v5__;
+  v17_sum_rest->as_compiled.captured[1] = v16_sum;
+  v18_adder->as_compiled.captured[0] = v5__;
+  v19_greet->as_compiled.captured[0] = v9_concat;
+  Value v33_current_lambda;
+  v33_current_lambda = make_compiled(vm, "current-lambda", f14_current_lambda, 7, k);
+  v33_current_lambda->as_compiled.captured[0] = v12_slow_fib;
+  v33_current_lambda->as_compiled.captured[1] = v13_count_up;
+  v33_current_lambda->as_compiled.captured[2] = v14_even_;
+  v33_current_lambda->as_compiled.captured[3] = v16_sum;
+  v33_current_lambda->as_compiled.captured[4] = v18_adder;
+  v33_current_lambda->as_compiled.captured[5] = v19_greet;
+  v33_current_lambda->as_compiled.captured[6] = v20_quoted;
+  return v33_current_lambda;
+}
+
+static Value f2_current_let(VM& vm, Value self, const Value* args, size_t n) {
+  const Value* k = self->as_compiled.constants;
+  Value v3_core;
+  VM_EXPECT(vm, n == 1);
+  v3_core = args[0];
+  Value v4_current_let;
+  v4_current_let = make_compiled(vm, "current-let", f3_current_let, 0, k);
+  Value t57[] = {k[15]};
+  Value t58 = apply(vm, v3_core, t57, 1);
+  Value t59[] = {k[16]};
+  Value t60 = apply(vm, v3_core, t59, 1);
+  Value t61[] = {k[17]};
+  Value t62 = apply(vm, v3_core, t61, 1);
+  Value t63[] = {k[18]};
+  Value t64 = apply(vm, v3_core, t63, 1);
+  Value t65[] = {k[19]};
+  Value t66 = apply(vm, v3_core, t65, 1);
+  Value t67[] = {k[20]};
+  Value t68 = apply(vm, v3_core, t67, 1);
+  Value t69[] = {k[21]};
+  Value t70 = apply(vm, v3_core, t69, 1);
+  Value t71[] = {t58, t60, t62, t64, t66, t68, t70};
+  return compiled_tail_call(vm, v4_current_let, t71, 7);
+}
+
+static Value f1_current_lambda(VM& vm, Value self, const Value* args, size_t n) {
+  const Value* k = self->as_compiled.constants;
+  Value v1_env;
+  VM_EXPECT(vm, n == 1);
+  v1_env = args[0];
+  Value v2_current_let;
+  v2_current_let = make_compiled(vm, "current-let", f2_current_let, 0, k);
+  Value t72[] = {k[22]};
+  Value t73 = apply(vm, v1_env, t72, 1);
+  Value t74[] = {t73};
+  return compiled_tail_call(vm, v2_current_let, t74, 1);
+}
+
+static Value f0_module(VM& vm, Value self, const Value* args, size_t n) {
+  const Value* k = self->as_compiled.constants;
+  VM_EXPECT(vm, n == 0);
+  Value v0_current_lambda;
+  v0_current_lambda = make_compiled(vm, "current-lambda", f1_current_lambda, 0, k);
+  return v0_current_lambda;
+}
+
+extern "C" void mylisp_compiled_module(VM& vm, Value* moduleFunc) {
+  Value* k = (Value*)vm.alloc(sizeof(Value) * 24);
+  k[0] = vm.makeInteger(0);
+  k[1] = vm.makeInteger(1);
+  k[2] = vm.makeInteger(2);
+  k[3] = vm.makeSymbol(String("Nil", 3));
+  k[4] = vm.copyString(String("hello, \"", 8));
+  k[5] = vm.copyString(String("\"\012", 2));
+  k[6] = compiled_list(vm, {vm.makeSymbol(String("a", 1)), vm.copyString(String("b", 1)), vm.makeInteger(3), compiled_list(vm, {vm.makeInteger(4)}, vm.makeInteger(5))}, vm.nil);
+  k[7] = compiled_builtin(vm, "is_equal");
+  k[8] = vm.makeSymbol(String("slow-fib", 8));
+  k[9] = vm.makeSymbol(String("count-up", 8));
+  k[10] = vm.makeSymbol(String("even\?", 5));
+  k[11] = vm.makeSymbol(String("sum", 3));
+  k[12] = vm.makeSymbol(String("adder", 5));
+  k[13] = vm.makeSymbol(String("greet", 5));
+  k[14] = vm.makeSymbol(String("quoted", 6));
+  k[15] = vm.makeSymbol(String("+", 1));
+  k[16] = vm.makeSymbol(String("-", 1));
+  k[17] = vm.makeSymbol(String("eq\?", 3));
+  k[18] = vm.makeSymbol(String("ctor", 4));
+  k[19] = vm.makeSymbol(String("concat", 6));
+  k[20] = vm.makeSymbol(String("first", 5));
+  k[21] = vm.makeSymbol(String("rest", 4));
+  k[22] = vm.makeSymbol(String("core", 4));
+  *moduleFunc = apply(vm, make_compiled(vm, "module", f0_module, 0, k), 0, 0);
+}
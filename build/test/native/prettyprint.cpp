@@ -0,0 +1,488 @@
+// Compiled by mylisp --compile-c from src/prettyprint.ss; build with
+//   clang++ -std=c++11 -fPIC -shared -I<mylisp>/src -o <name>.so <this file>
+// and load as native/<name>.
+
+#include "compiled.h"
+
+static Value f4_list_tostring(VM& vm, Value self, const Value* args, size_t n);
+static Value f5_n_spaces(VM& vm, Value self, const Value* args, size_t n);
+static Value f7_current_let(VM& vm, Value self, const Value* args, size_t n);
+static Value f6_value_tostring(VM& vm, Value self, const Value* args, size_t n);
+static Value f8_tostring(VM& vm, Value self, const Value* args, size_t n);
+static Value f9_tostring_indented(VM& vm, Value self, const Value* args, size_t n);
+static Value f10_current_lambda(VM& vm, Value self, const Value* args, size_t n);
+static Value f3_current_let(VM& vm, Value self, const Value* args, size_t n);
+static Value f2_current_let(VM& vm, Value self, const Value* args, size_t n);
+static Value f1_current_lambda(VM& vm, Value self, const Value* args, size_t n);
+static Value f0_module(VM& vm, Value self, const Value* args, size_t n);
+
+static Value f4_list_tostring(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  const Value* k = self->as_compiled.constants;
+  Value v27_prefix;
+  Value v28_value;
+  Value v29_indent;
+  Value v30_list_on_newline;
+  Value v31_value_stringer;
+  Value loop[5];
+top:
+  VM_EXPECT(vm, n == 5);
+  v27_prefix = args[0];
+  v28_value = args[1];
+  v29_indent = args[2];
+  v30_list_on_newline = args[3];
+  v31_value_stringer = args[4];
+  Value t0[] = {v28_value};
+  Value t1 = apply(vm, c[1], t0, 1);
+  Value t2[] = {t1, k[0]};
+  Value t3 = apply(vm, c[0], t2, 2);
+  if(t3.asBool(vm)) {
+    Value t4[] = {v27_prefix, k[1]};
+    return compiled_tail_call(vm, c[2], t4, 2);
+  } else {
+    Value t5[] = {v28_value};
+    Value t6 = apply(vm, c[1], t5, 1);
+    Value t7[] = {t6, k[2]};
+    Value t8 = apply(vm, c[0], t7, 2);
+    if(t8.asBool(vm)) {
+      Value t9[] = {v28_value};
+      Value t10 = apply(vm, c[4], t9, 1);
+      Value t11[] = {t10, v29_indent, vm.true_};
+      Value t12 = apply(vm, v31_value_stringer, t11, 3);
+      Value t13[] = {v27_prefix, k[3], t12};
+      Value t14 = apply(vm, c[2], t13, 3);
+      Value t15[] = {v28_value};
+      Value t16 = apply(vm, c[5], t15, 1);
+      loop[0] = t14;
+      loop[1] = t16;
+      loop[2] = v29_indent;
+      loop[3] = vm.true_;
+      loop[4] = v31_value_stringer;
+      args = loop;
+      n = 5;
+      goto top;
+    } else {
+      Value t17[] = {v28_value, v29_indent, vm.true_};
+      Value t18 = apply(vm, v31_value_stringer, t17, 3);
+      Value t19[] = {v27_prefix, k[4], t18, k[5]};
+      return compiled_tail_call(vm, c[2], t19, 4);
+    }
+  }
+}
+
+static Value f5_n_spaces(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  const Value* k = self->as_compiled.constants;
+  Value v32_n;
+  VM_EXPECT(vm, n == 1);
+  v32_n = args[0];
+  Value t20[] = {v32_n, k[6]};
+  Value t21 = apply(vm, c[0], t20, 2);
+  if(t21.asBool(vm)) {
+    return k[7];
+  } else {
+    Value t22[] = {v32_n, k[9]};
+    Value t23 = apply(vm, c[3], t22, 2);
+    Value t24[] = {t23};
+    Value t25 = apply(vm, c[2], t24, 1);
+    Value t26[] = {k[8], t25};
+    return compiled_tail_call(vm, c[1], t26, 2);
+  }
+}
+
+static Value f7_current_let(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  const Value* k = self->as_compiled.constants;
+  Value v37_s;
+  VM_EXPECT(vm, n == 1);
+  v37_s = args[0];
+  Value t101[] = {k[28], v37_s, k[29]};
+  return compiled_tail_call(vm, c[0], t101, 3);
+}
+
+static Value f6_value_tostring(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  const Value* k = self->as_compiled.constants;
+  Value v33_value;
+  Value v34_indent;
+  Value v35_list_on_newline;
+  VM_EXPECT(vm, n == 3);
+  v33_value = args[0];
+  v34_indent = args[1];
+  v35_list_on_newline = args[2];
+  Value t27[] = {v33_value};
+  Value t28 = apply(vm, c[1], t27, 1);
+  Value t29[] = {t28, k[0]};
+  Value t30 = apply(vm, c[0], t29, 2);
+  if(t30.asBool(vm)) {
+    return k[10];
+  } else {
+    Value t31[] = {v33_value};
+    Value t32 = apply(vm, c[1], t31, 1);
+    Value t33[] = {t32, k[2]};
+    Value t34 = apply(vm, c[0], t33, 2);
+    if(t34.asBool(vm)) {
+      Value t35;
+      if(v35_list_on_newline.asBool(vm)) {
+        Value t36[] = {v34_indent};
+        Value t37 = apply(vm, c[4], t36, 1);
+        Value t38[] = {k[11], t37};
+        Value t39 = apply(vm, c[3], t38, 2);
+        t35 = t39;
+      } else {
+        t35 = k[7];
+      }
+      Value t40[] = {v33_value};
+      Value t41 = apply(vm, c[6], t40, 1);
+      Value t42[] = {v34_indent, k[13]};
+      Value t43 = apply(vm, c[7], t42, 2);
+      Value t44[] = {t41, t43, vm.false_};
+      Value t45 = apply(vm, c[5], t44, 3);
+      Value t46[] = {t35, k[12], t45};
+      Value t47 = apply(vm, c[3], t46, 3);
+      Value t48[] = {v33_value};
+      Value t49 = apply(vm, c[8], t48, 1);
+      Value t50[] = {v34_indent, k[13]};
+      Value t51 = apply(vm, c[7], t50, 2);
+      Value t52[] = {t47, t49, t51, vm.true_, c[5]};
+      return compiled_tail_call(vm, c[2], t52, 5);
+    } else {
+      Value t53[] = {v33_value};
+      Value t54 = apply(vm, c[1], t53, 1);
+      Value t55[] = {t54, k[14]};
+      Value t56 = apply(vm, c[0], t55, 2);
+      if(t56.asBool(vm)) {
+        Value t57[] = {v33_value};
+        return compiled_tail_call(vm, c[9], t57, 1);
+      } else {
+        Value t58[] = {v33_value};
+        Value t59 = apply(vm, c[1], t58, 1);
+        Value t60[] = {t59, k[15]};
+        Value t61 = apply(vm, c[0], t60, 2);
+        if(t61.asBool(vm)) {
+          Value t62[] = {v33_value};
+          return compiled_tail_call(vm, c[10], t62, 1);
+        } else {
+          Value t63[] = {v33_value};
+          Value t64 = apply(vm, c[1], t63, 1);
+          Value t65[] = {t64, k[16]};
+          Value t66 = apply(vm, c[0], t65, 2);
+          if(t66.asBool(vm)) {
+            Value t67[] = {v33_value};
+            Value t68 = apply(vm, c[11], t67, 1);
+            Value t69[] = {k[17], t68, k[18]};
+            return compiled_tail_call(vm, c[3], t69, 3);
+          } else {
+            Value t70[] = {v33_value};
+            Value t71 = apply(vm, c[1], t70, 1);
+            Value t72[] = {t71, k[19]};
+            Value t73 = apply(vm, c[0], t72, 2);
+            if(t73.asBool(vm)) {
+              if(v33_value.asBool(vm)) {
+                return k[20];
+              } else {
+                return k[21];
+              }
+            } else {
+              Value t74[] = {v33_value};
+              Value t75 = apply(vm, c[1], t74, 1);
+              Value t76[] = {t75, k[22]};
+              Value t77 = apply(vm, c[0], t76, 2);
+              if(t77.asBool(vm)) {
+                Value t78[] = {v33_value};
+                Value t79 = apply(vm, c[12], t78, 1);
+                Value t80[] = {t79, v34_indent, v35_list_on_newline};
+                Value t81 = apply(vm, c[5], t80, 3);
+                Value t82[] = {k[23], t81};
+                return compiled_tail_call(vm, c[3], t82, 2);
+              } else {
+                Value t83[] = {v33_value};
+                Value t84 = apply(vm, c[1], t83, 1);
+                Value t85[] = {t84, k[24]};
+                Value t86 = apply(vm, c[0], t85, 2);
+                if(t86.asBool(vm)) {
+                  Value t87[] = {v33_value};
+                  Value t88 = apply(vm, c[13], t87, 1);
+                  Value t89[] = {t88, v34_indent, v35_list_on_newline};
+                  Value t90 = apply(vm, c[5], t89, 3);
+                  Value t91[] = {k[25], t90};
+                  return compiled_tail_call(vm, c[3], t91, 2);
+                } else {
+                  Value t92[] = {v33_value};
+                  Value t93 = apply(vm, c[1], t92, 1);
+                  Value t94[] = {t93, k[26]};
+                  Value t95 = apply(vm, c[0], t94, 2);
+                  if(t95.asBool(vm)) {
+                    Value t96[] = {v33_value};
+                    Value t97 = apply(vm, c[14], t96, 1);
+                    Value t98[] = {t97, v34_indent, v35_list_on_newline};
+                    Value t99 = apply(vm, c[5], t98, 3);
+                    Value t100[] = {k[27], t99};
+                    return compiled_tail_call(vm, c[3], t100, 2);
+                  } else {
+                    Value v36_current_let;
+                    v36_current_let = make_compiled(vm, "current-let", f7_current_let, 1, k);
+                    v36_current_let->as_compiled.captured[0] = c[3];
+                    Value t102[] = {v33_value};
+                    Value t103 = apply(vm, c[1], t102, 1);
+                    Value t104[] = {t103};
+                    Value t105 = apply(vm, c[9], t104, 1);
+                    Value t106[] = {t105};
+                    return compiled_tail_call(vm, v36_current_let, t106, 1);
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+static Value f8_tostring(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  const Value* k = self->as_compiled.constants;
+  Value v38_value;
+  VM_EXPECT(vm, n == 1);
+  v38_value = args[0];
+  Value t107[] = {v38_value, k[6], vm.false_};
+  return compiled_tail_call(vm, c[0], t107, 3);
+}
+
+static Value f9_tostring_indented(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  Value v39_value;
+  Value v40_indent;
+  VM_EXPECT(vm, n == 2);
+  v39_value = args[0];
+  v40_indent = args[1];
+  Value t108[] = {v39_value, v40_indent, vm.false_};
+  return compiled_tail_call(vm, c[0], t108, 3);
+}
+
+static Value f10_current_lambda(VM& vm, Value self, const Value* args, size_t n) {
+  Value* c = self->as_compiled.captured;
+  const Value* k = self->as_compiled.constants;
+  Value v42_sym_name;
+  VM_EXPECT(vm, n == 1);
+  v42_sym_name = args[0];
+  Value t109[] = {v42_sym_name, k[31]};
+  Value t110 = builtin_func(k[30])(vm, t109, 2);
+  if(t110.asBool(vm)) {
+    return c[0];
+  } else {
+    Value t111[] = {v42_sym_name, k[32]};
+    Value t112 = builtin_func(k[30])(vm, t111, 2);
+    if(t112.asBool(vm)) {
+      return c[1];
+    } else {
+      Value t113 = compiled_unbound(vm, "error");
+      Value t114[] = {v42_sym_name};
+      return compiled_tail_call(vm, t113, t114, 1);
+    }
+  }
+}
+
+static Value f3_current_let(VM& vm, Value self, const Value* args, size_t n) {
+  const Value* k = self->as_compiled.constants;
+  Value v5_concat;
+  Value v6_split;
+  Value v7__;
+  Value v8__;
+  Value v9__;
+  Value v10__;
+  Value v11_modulo;
+  Value v12_eq_;
+  Value v13_sym_name;
+  Value v14_first;
+  Value v15_rest;
+  Value v16_ctor;
+  Value v17_vector_to_list;
+  Value v18_hash_to_list;
+  Value v19_array_to_list;
+  Value v20_int_to_string;
+  Value v21_string_escape;
+  VM_EXPECT(vm, n == 17);
+  v5_concat = args[0];
+  v6_split = args[1];
+  v7__ = args[2];
+  v8__ = args[3];
+  v9__ = args[4];
+  v10__ = args[5];
+  v11_modulo = args[6];
+  v12_eq_ = args[7];
+  v13_sym_name = args[8];
+  v14_first = args[9];
+  v15_rest = args[10];
+  v16_ctor = args[11];
+  v17_vector_to_list = args[12];
+  v18_hash_to_list = args[13];
+  v19_array_to_list = args[14];
+  v20_int_to_string = args[15];
+  v21_string_escape = args[16];
+  Value v22_list_tostring;
+  Value v23_n_spaces;
+  Value v24_value_tostring;
+  Value v25_tostring;
+  Value v26_tostring_indented;
+  v22_list_tostring = make_compiled(vm, "list-tostring", f4_list_tostring, 6, k);
+  v23_n_spaces = make_compiled(vm, "n-spaces", f5_n_spaces, 4, k);
+  v24_value_tostring = make_compiled(vm, "value-tostring", f6_value_tostring, 15, k);
+  v25_tostring = make_compiled(vm, "tostring", f8_tostring, 1, k);
+  v26_tostring_indented = make_compiled(vm, "tostring-indented", f9_tostring_indented, 1, k);
+  v22_list_tostring->as_compiled.captured[0] = v12_eq_;
+  v22_list_tostring->as_compiled.captured[1] = v16_ctor;
+  v22_list_tostring->as_compiled.captured[2] = v5_concat;
+  v22_list_tostring->as_compiled.captured[3] = v22_list_tostring;
+  v22_list_tostring->as_compiled.captured[4] = v14_first;
+  v22_list_tostring->as_compiled.captured[5] = v15_rest;
+  v23_n_spaces->as_compiled.captured[0] = v12_eq_;
+  v23_n_spaces->as_compiled.captured[1] = v5_concat;
+  v23_n_spaces->as_compiled.captured[2] = v23_n_spaces;
+  v23_n_spaces->as_compiled.captured[3] = v8__;
+  v24_value_tostring->as_compiled.captured[0] = v12_eq_;
+  v24_value_tostring->as_compiled.captured[1] = v16_ctor;
+  v24_value_tostring->as_compiled.captured[2] = v22_list_tostring;
+  v24_value_tostring->as_compiled.captured[3] = v5_concat;
+  v24_value_tostring->as_compiled.captured[4] = v23_n_spaces;
+  v24_value_tostring->as_compiled.captured[5] = v24_value_tostring;
+  v24_value_tostring->as_compiled.captured[6] = v14_first;
+  v24_value_tostring->as_compiled.captured[7] = v7__;
+  v24_value_tostring->as_compiled.captured[8] = v15_rest;
+  v24_value_tostring->as_compiled.captured[9] = v13_sym_name;
+  v24_value_tostring->as_compiled.captured[10] = v20_int_to_string;
+  v24_value_tostring->as_compiled.captured[11] = v21_string_escape;
+  v24_value_tostring->as_compiled.captured[12] = v17_vector_to_list;
+  v24_value_tostring->as_compiled.captured[13] = v18_hash_to_list;
+  v24_value_tostring->as_compiled.captured[14] = v19_array_to_list;
+  v25_tostring->as_compiled.captured[0] = v24_value_tostring;
+  v26_tostring_indented->as_compiled.captured[0] = v24_value_tostring;
+  Value v41_current_lambda;
+  v41_current_lambda = make_compiled(vm, "current-lambda", f10_current_lambda, 2, k);
+  v41_current_lambda->as_compiled.captured[0] = v25_tostring;
+  v41_current_lambda->as_compiled.captured[1] = v26_tostring_indented;
+  return v41_current_lambda;
+}
+
+static Value f2_current_let(VM& vm, Value self, const Value* args, size_t n) {
+  const Value* k = self->as_compiled.constants;
+  Value v3_core;
+  VM_EXPECT(vm, n == 1);
+  v3_core = args[0];
+  Value v4_current_let;
+  v4_current_let = make_compiled(vm, "current-let", f3_current_let, 0, k);
+  Value t115[] = {k[33]};
+  Value t116 = apply(vm, v3_core, t115, 1);
+  Value t117[] = {k[34]};
+  Value t118 = apply(vm, v3_core, t117, 1);
+  Value t119[] = {k[35]};
+  Value t120 = apply(vm, v3_core, t119, 1);
+  Value t121[] = {k[36]};
+  Value t122 = apply(vm, v3_core, t121, 1);
+  Value t123[] = {k[37]};
+  Value t124 = apply(vm, v3_core, t123, 1);
+  Value t125[] = {k[38]};
+  Value t126 = apply(vm, v3_core, t125, 1);
+  Value t127[] = {k[39]};
+  Value t128 = apply(vm, v3_core, t127, 1);
+  Value t129[] = {k[40]};
+  Value t130 = apply(vm, v3_core, t129, 1);
+  Value t131[] = {k[41]};
+  Value t132 = apply(vm, v3_core, t131, 1);
+  Value t133[] = {k[42]};
+  Value t134 = apply(vm, v3_core, t133, 1);
+  Value t135[] = {k[43]};
+  Value t136 = apply(vm, v3_core, t135, 1);
+  Value t137[] = {k[44]};
+  Value t138 = apply(vm, v3_core, t137, 1);
+  Value t139[] = {k[45]};
+  Value t140 = apply(vm, v3_core, t139, 1);
+  Value t141[] = {k[46]};
+  Value t142 = apply(vm, v3_core, t141, 1);
+  Value t143[] = {k[47]};
+  Value t144 = apply(vm, v3_core, t143, 1);
+  Value t145[] = {k[48]};
+  Value t146 = apply(vm, v3_core, t145, 1);
+  Value t147[] = {k[49]};
+  Value t148 = apply(vm, v3_core, t147, 1);
+  Value t149[] = {t116, t118, t120, t122, t124, t126, t128, t130, t132, t134, t136, t138, t140, t142, t144, t146, t148};
+  return compiled_tail_call(vm, v4_current_let, t149, 17);
+}
+
+static Value f1_current_lambda(VM& vm, Value self, const Value* args, size_t n) {
+  const Value* k = self->as_compiled.constants;
+  Value v1_env;
+  VM_EXPECT(vm, n == 1);
+  v1_env = args[0];
+  Value v2_current_let;
+  v2_current_let = make_compiled(vm, "current-let", f2_current_let, 0, k);
+  Value t150[] = {k[50]};
+  Value t151 = apply(vm, v1_env, t150, 1);
+  Value t152[] = {t151};
+  return compiled_tail_call(vm, v2_current_let, t152, 1);
+}
+
+static Value f0_module(VM& vm, Value self, const Value* args, size_t n) {
+  const Value* k = self->as_compiled.constants;
+  VM_EXPECT(vm, n == 0);
+  Value v0_current_lambda;
+  v0_current_lambda = make_compiled(vm, "current-lambda", f1_current_lambda, 0, k);
+  return v0_current_lambda;
+}
+
+extern "C" void mylisp_compiled_module(VM& vm, Value* moduleFunc) {
+  Value* k = (Value*)vm.alloc(sizeof(Value) * 52);
+  k[0] = vm.makeSymbol(String("Nil", 3));
+  k[1] = vm.copyString(String(")", 1));
+  k[2] = vm.makeSymbol(String("cons", 4));
+  k[3] = vm.copyString(String(" ", 1));
+  k[4] = vm.copyString(String(" . ", 3));
+  k[5] = vm.copyString(String(")", 1));
+  k[6] = vm.makeInteger(0);
+  k[7] = vm.copyString(String("", 0));
+  k[8] = vm.copyString(String(" ", 1));
+  k[9] = vm.makeInteger(1);
+  k[10] = vm.copyString(String("()", 2));
+  k[11] = vm.copyString(String("\012", 1));
+  k[12] = vm.copyString(String("(", 1));
+  k[13] = vm.makeInteger(2);
+  k[14] = vm.makeSymbol(String("Symbol", 6));
+  k[15] = vm.makeSymbol(String("Integer", 7));
+  k[16] = vm.makeSymbol(String("String", 6));
+  k[17] = vm.copyString(String("\"", 1));
+  k[18] = vm.copyString(String("\"", 1));
+  k[19] = vm.makeSymbol(String("Bool", 4));
+  k[20] = vm.copyString(String("#t", 2));
+  k[21] = vm.copyString(String("#f", 2));
+  k[22] = vm.makeSymbol(String("Vector", 6));
+  k[23] = vm.copyString(String("#", 1));
+  k[24] = vm.makeSymbol(String("HashMap", 7));
+  k[25] = vm.copyString(String("#hash", 5));
+  k[26] = vm.makeSymbol(String("Array", 5));
+  k[27] = vm.copyString(String("#array", 6));
+  k[28] = vm.copyString(String("<", 1));
+  k[29] = vm.copyString(String(">", 1));
+  k[30] = compiled_builtin(vm, "is_equal");
+  k[31] = vm.makeSymbol(String("tostring", 8));
+  k[32] = vm.makeSymbol(String("tostring-indented", 17));
+  k[33] = vm.makeSymbol(String("concat", 6));
+  k[34] = vm.makeSymbol(String("split", 5));
+  k[35] = vm.makeSymbol(String("+", 1));
+  k[36] = vm.makeSymbol(String("-", 1));
+  k[37] = vm.makeSymbol(String("*", 1));
+  k[38] = vm.makeSymbol(String("/", 1));
+  k[39] = vm.makeSymbol(String("modulo", 6));
+  k[40] = vm.makeSymbol(String("eq\?", 3));
+  k[41] = vm.makeSymbol(String("sym-name", 8));
+  k[42] = vm.makeSymbol(String("first", 5));
+  k[43] = vm.makeSymbol(String("rest", 4));
+  k[44] = vm.makeSymbol(String("ctor", 4));
+  k[45] = vm.makeSymbol(String("vector-to-list", 14));
+  k[46] = vm.makeSymbol(String("hash-to-list", 12));
+  k[47] = vm.makeSymbol(String("array-to-list", 13));
+  k[48] = vm.makeSymbol(String("int-to-string", 13));
+  k[49] = vm.makeSymbol(String("string-escape", 13));
+  k[50] = vm.makeSymbol(String("core", 4));
+  *moduleFunc = apply(vm, make_compiled(vm, "module", f0_module, 0, k), 0, 0);
+}
@@ -0,0 +1,412 @@
+const char binary_transform_data[] = {
+  0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61,
+  0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x03,
+  0x65, 0x6e, 0x76, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c,
+  0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0b,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01,
+  0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c,
+  0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01,
+  0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c,
+  0x65, 0x74, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x04, 0x04, 0x72,
+  0x65, 0x73, 0x74, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01,
+  0x04, 0x04, 0x63, 0x6f, 0x6e, 0x73, 0x01, 0x04, 0x01, 0x2b, 0x01, 0x04,
+  0x04, 0x63, 0x74, 0x6f, 0x72, 0x01, 0x04, 0x08, 0x68, 0x61, 0x73, 0x68,
+  0x2d, 0x6d, 0x61, 0x70, 0x01, 0x04, 0x0b, 0x6d, 0x61, 0x63, 0x72, 0x6f,
+  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c,
+  0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01,
+  0x01, 0x04, 0x04, 0x6e, 0x69, 0x6c, 0x3f, 0x01, 0x04, 0x01, 0x76, 0x00,
+  0x01, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x01, 0x04, 0x04, 0x63,
+  0x74, 0x6f, 0x72, 0x01, 0x04, 0x01, 0x76, 0x00, 0x01, 0x01, 0x04, 0x05,
+  0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x03, 0x4e, 0x69, 0x6c, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x05, 0x63, 0x6f, 0x6e, 0x73, 0x3f,
+  0x01, 0x04, 0x01, 0x76, 0x00, 0x01, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f,
+  0x01, 0x01, 0x04, 0x04, 0x63, 0x74, 0x6f, 0x72, 0x01, 0x04, 0x01, 0x76,
+  0x00, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04,
+  0x04, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04,
+  0x04, 0x73, 0x79, 0x6d, 0x3f, 0x01, 0x04, 0x01, 0x76, 0x00, 0x01, 0x01,
+  0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x01, 0x04, 0x04, 0x63, 0x74, 0x6f,
+  0x72, 0x01, 0x04, 0x01, 0x76, 0x00, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75,
+  0x6f, 0x74, 0x65, 0x01, 0x04, 0x06, 0x53, 0x79, 0x6d, 0x62, 0x6f, 0x6c,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x03, 0x61, 0x6e, 0x64, 0x01,
+  0x04, 0x01, 0x61, 0x01, 0x04, 0x01, 0x62, 0x00, 0x01, 0x01, 0x04, 0x02,
+  0x69, 0x66, 0x01, 0x04, 0x01, 0x61, 0x01, 0x04, 0x01, 0x62, 0x01, 0x07,
+  0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x03, 0x6e, 0x6f, 0x74, 0x01, 0x04,
+  0x01, 0x61, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x04, 0x01,
+  0x61, 0x01, 0x07, 0x01, 0x06, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x04,
+  0x6c, 0x69, 0x73, 0x74, 0x04, 0x05, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x01,
+  0x04, 0x05, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x00, 0x01, 0x01, 0x01, 0x04,
+  0x06, 0x66, 0x69, 0x72, 0x73, 0x74, 0x73, 0x01, 0x04, 0x03, 0x76, 0x61,
+  0x6c, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x04,
+  0x6e, 0x69, 0x6c, 0x3f, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x00, 0x01,
+  0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x6e, 0x73, 0x01, 0x01, 0x04,
+  0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69,
+  0x72, 0x73, 0x74, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x01,
+  0x01, 0x04, 0x06, 0x66, 0x69, 0x72, 0x73, 0x74, 0x73, 0x01, 0x01, 0x04,
+  0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x07, 0x73, 0x65, 0x63,
+  0x6f, 0x6e, 0x64, 0x73, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x00, 0x01,
+  0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x04, 0x6e, 0x69, 0x6c,
+  0x3f, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x00, 0x01, 0x00, 0x01, 0x01,
+  0x04, 0x04, 0x63, 0x6f, 0x6e, 0x73, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69,
+  0x72, 0x73, 0x74, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01,
+  0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01, 0x04, 0x03, 0x76,
+  0x61, 0x6c, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x07, 0x73, 0x65, 0x63,
+  0x6f, 0x6e, 0x64, 0x73, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74,
+  0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x01, 0x04, 0x03, 0x6d, 0x61, 0x70, 0x01, 0x04, 0x04, 0x66, 0x75,
+  0x6e, 0x63, 0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x01, 0x01,
+  0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x04, 0x6e, 0x69, 0x6c, 0x3f,
+  0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x01, 0x00, 0x01, 0x01,
+  0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x05, 0x63, 0x6f, 0x6e, 0x73,
+  0x3f, 0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x01, 0x01, 0x04,
+  0x04, 0x63, 0x6f, 0x6e, 0x73, 0x01, 0x01, 0x04, 0x04, 0x66, 0x75, 0x6e,
+  0x63, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01, 0x04,
+  0x04, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x00, 0x01, 0x01, 0x04, 0x03, 0x6d,
+  0x61, 0x70, 0x01, 0x04, 0x04, 0x66, 0x75, 0x6e, 0x63, 0x01, 0x01, 0x04,
+  0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x66, 0x75, 0x6e, 0x63, 0x01,
+  0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x04, 0x0c, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x6c, 0x61, 0x6d, 0x62,
+  0x64, 0x61, 0x73, 0x01, 0x04, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x01, 0x04,
+  0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65,
+  0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01,
+  0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65,
+  0x74, 0x01, 0x04, 0x07, 0x66, 0x6e, 0x2d, 0x61, 0x72, 0x67, 0x73, 0x00,
+  0x01, 0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x01, 0x01, 0x04, 0x04,
+  0x63, 0x6f, 0x6e, 0x73, 0x01, 0x04, 0x07, 0x66, 0x6e, 0x2d, 0x61, 0x72,
+  0x67, 0x73, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04,
+  0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65,
+  0x74, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x6e, 0x73, 0x01, 0x04, 0x04,
+  0x6e, 0x61, 0x6d, 0x65, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73,
+  0x74, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x01, 0x04, 0x0e, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73,
+  0x73, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x04, 0x66,
+  0x6f, 0x72, 0x6d, 0x00, 0x01, 0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74,
+  0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x0a,
+  0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x00, 0x01,
+  0x01, 0x04, 0x0c, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x6c, 0x61, 0x6d, 0x62,
+  0x64, 0x61, 0x73, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65,
+  0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c,
+  0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65,
+  0x73, 0x74, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x01,
+  0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x0e, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64,
+  0x61, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x06, 0x6c, 0x65, 0x74,
+  0x2d, 0x66, 0x6e, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x01,
+  0x01, 0x04, 0x0c, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x6c, 0x61, 0x6d, 0x62,
+  0x64, 0x61, 0x73, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65,
+  0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c,
+  0x65, 0x74, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x6e, 0x73, 0x01,
+  0x01, 0x04, 0x06, 0x66, 0x69, 0x72, 0x73, 0x74, 0x73, 0x01, 0x01, 0x04,
+  0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72,
+  0x6d, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01,
+  0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x04, 0x08, 0x6c, 0x65, 0x74, 0x2d, 0x62, 0x6f, 0x64, 0x79, 0x01,
+  0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63,
+  0x6f, 0x6e, 0x73, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65,
+  0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c,
+  0x65, 0x74, 0x00, 0x01, 0x01, 0x04, 0x07, 0x73, 0x65, 0x63, 0x6f, 0x6e,
+  0x64, 0x73, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01,
+  0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x04, 0x0b, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x2d, 0x6c,
+  0x65, 0x74, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x01, 0x01,
+  0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75,
+  0x6f, 0x74, 0x65, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d,
+  0x62, 0x64, 0x61, 0x73, 0x00, 0x01, 0x01, 0x04, 0x06, 0x6c, 0x65, 0x74,
+  0x2d, 0x66, 0x6e, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01,
+  0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x01, 0x01, 0x04, 0x08,
+  0x6c, 0x65, 0x74, 0x2d, 0x62, 0x6f, 0x64, 0x79, 0x01, 0x01, 0x04, 0x04,
+  0x72, 0x65, 0x73, 0x74, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x0f, 0x63, 0x6f, 0x6c, 0x6c,
+  0x65, 0x63, 0x74, 0x2d, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x01,
+  0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69,
+  0x66, 0x01, 0x01, 0x04, 0x04, 0x6e, 0x69, 0x6c, 0x3f, 0x01, 0x04, 0x04,
+  0x66, 0x6f, 0x72, 0x6d, 0x00, 0x01, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69,
+  0x66, 0x01, 0x01, 0x04, 0x03, 0x6e, 0x6f, 0x74, 0x01, 0x01, 0x04, 0x05,
+  0x63, 0x6f, 0x6e, 0x73, 0x3f, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d,
+  0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01,
+  0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01,
+  0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x01, 0x01, 0x04, 0x05,
+  0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x06, 0x69, 0x6d, 0x70, 0x6f,
+  0x72, 0x74, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x6e, 0x73,
+  0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x01, 0x04, 0x05,
+  0x66, 0x69, 0x72, 0x73, 0x74, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d,
+  0x00, 0x00, 0x01, 0x01, 0x04, 0x0f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63,
+  0x74, 0x2d, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x01, 0x01, 0x04,
+  0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0f, 0x63, 0x6f, 0x6c, 0x6c, 0x65,
+  0x63, 0x74, 0x2d, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x01, 0x01,
+  0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72,
+  0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x0f,
+  0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x2d, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x73, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x01,
+  0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x04, 0x6e, 0x69, 0x6c,
+  0x3f, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x03, 0x6e, 0x6f, 0x74,
+  0x01, 0x01, 0x04, 0x05, 0x63, 0x6f, 0x6e, 0x73, 0x3f, 0x01, 0x04, 0x04,
+  0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x04, 0x02,
+  0x69, 0x66, 0x01, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x01, 0x04,
+  0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69,
+  0x72, 0x73, 0x74, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00,
+  0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x06,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04,
+  0x63, 0x6f, 0x6e, 0x73, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74,
+  0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01, 0x04, 0x04,
+  0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0f, 0x63, 0x6f,
+  0x6c, 0x6c, 0x65, 0x63, 0x74, 0x2d, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x73, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04, 0x04,
+  0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0f, 0x63,
+  0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x2d, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x65, 0x73, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04,
+  0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x01, 0x04, 0x0f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x2d,
+  0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x01, 0x04, 0x04, 0x66, 0x6f,
+  0x72, 0x6d, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04,
+  0x04, 0x6e, 0x69, 0x6c, 0x3f, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d,
+  0x00, 0x01, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04,
+  0x03, 0x6e, 0x6f, 0x74, 0x01, 0x01, 0x04, 0x05, 0x63, 0x6f, 0x6e, 0x73,
+  0x3f, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x01, 0x00,
+  0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x03, 0x65, 0x71,
+  0x3f, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01, 0x01,
+  0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01, 0x04, 0x04, 0x66, 0x6f,
+  0x72, 0x6d, 0x00, 0x00, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74,
+  0x65, 0x01, 0x04, 0x06, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x00, 0x00,
+  0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x6e, 0x73, 0x01, 0x01, 0x04, 0x04,
+  0x72, 0x65, 0x73, 0x74, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73,
+  0x74, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x01, 0x01,
+  0x04, 0x0f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x2d, 0x65, 0x78,
+  0x70, 0x6f, 0x72, 0x74, 0x73, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73,
+  0x74, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x04, 0x0f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x2d, 0x65,
+  0x78, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65,
+  0x73, 0x74, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x12, 0x6d, 0x61, 0x6b, 0x65,
+  0x2d, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x2d, 0x6c, 0x61, 0x6d, 0x62,
+  0x64, 0x61, 0x01, 0x04, 0x05, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x00, 0x01,
+  0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x01, 0x01, 0x04, 0x05, 0x71,
+  0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x06, 0x6c, 0x61, 0x6d, 0x62, 0x64,
+  0x61, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x6e, 0x73, 0x01, 0x01,
+  0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x03, 0x65, 0x6e,
+  0x76, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x05, 0x69, 0x6e, 0x6e, 0x65,
+  0x72, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x0b, 0x6d, 0x61, 0x6b, 0x65,
+  0x2d, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x01, 0x04, 0x04, 0x6e, 0x61,
+  0x6d, 0x65, 0x00, 0x01, 0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x01,
+  0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x03, 0x65,
+  0x6e, 0x76, 0x00, 0x01, 0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x01,
+  0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x05, 0x71,
+  0x75, 0x6f, 0x74, 0x65, 0x00, 0x01, 0x04, 0x04, 0x6e, 0x61, 0x6d, 0x65,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x0a, 0x6d, 0x6f, 0x64, 0x75,
+  0x6c, 0x65, 0x2d, 0x6d, 0x61, 0x70, 0x01, 0x04, 0x07, 0x69, 0x6d, 0x70,
+  0x6f, 0x72, 0x74, 0x73, 0x00, 0x01, 0x01, 0x04, 0x03, 0x6d, 0x61, 0x70,
+  0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64,
+  0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04,
+  0x03, 0x69, 0x6d, 0x70, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74,
+  0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04,
+  0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74,
+  0x01, 0x04, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x01, 0x01, 0x04, 0x04,
+  0x63, 0x6f, 0x6e, 0x73, 0x01, 0x04, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x01,
+  0x01, 0x04, 0x04, 0x63, 0x6f, 0x6e, 0x73, 0x01, 0x01, 0x04, 0x0b, 0x6d,
+  0x61, 0x6b, 0x65, 0x2d, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x01, 0x04,
+  0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d,
+  0x6c, 0x65, 0x74, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74,
+  0x01, 0x04, 0x03, 0x69, 0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61,
+  0x6d, 0x62, 0x64, 0x61, 0x00, 0x01, 0x04, 0x07, 0x69, 0x6d, 0x70, 0x6f,
+  0x72, 0x74, 0x73, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x10, 0x6d, 0x61,
+  0x6b, 0x65, 0x2d, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x2d, 0x6c,
+  0x65, 0x74, 0x01, 0x04, 0x07, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x73,
+  0x01, 0x04, 0x05, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x00, 0x01, 0x01, 0x04,
+  0x04, 0x6c, 0x69, 0x73, 0x74, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f,
+  0x74, 0x65, 0x01, 0x04, 0x03, 0x6c, 0x65, 0x74, 0x00, 0x01, 0x01, 0x04,
+  0x0a, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x2d, 0x6d, 0x61, 0x70, 0x01,
+  0x04, 0x07, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x00, 0x01, 0x04,
+  0x05, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04,
+  0x0b, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x2d, 0x6d, 0x61, 0x70,
+  0x01, 0x04, 0x07, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x00, 0x01,
+  0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61,
+  0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x04, 0x04, 0x6e, 0x61, 0x6d,
+  0x65, 0x01, 0x04, 0x03, 0x6c, 0x73, 0x74, 0x00, 0x01, 0x01, 0x04, 0x03,
+  0x6d, 0x61, 0x70, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61,
+  0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0e, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64,
+  0x61, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x00, 0x01, 0x01, 0x04, 0x04,
+  0x6c, 0x69, 0x73, 0x74, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x01, 0x01,
+  0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x01, 0x04, 0x04, 0x6e, 0x61, 0x6d,
+  0x65, 0x01, 0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x01, 0x01, 0x04,
+  0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f,
+  0x74, 0x65, 0x00, 0x01, 0x04, 0x03, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+  0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x01, 0x04, 0x03, 0x6c,
+  0x73, 0x74, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0b, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x01, 0x04, 0x05,
+  0x66, 0x69, 0x72, 0x73, 0x74, 0x01, 0x04, 0x07, 0x69, 0x6d, 0x70, 0x6f,
+  0x72, 0x74, 0x73, 0x00, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73,
+  0x74, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04, 0x07,
+  0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x04, 0x10, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x69, 0x6d,
+  0x70, 0x6f, 0x72, 0x74, 0x73, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x04, 0x07,
+  0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x01, 0x04, 0x05, 0x69, 0x6e,
+  0x6e, 0x65, 0x72, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01,
+  0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x04, 0x07, 0x69, 0x6d, 0x70, 0x6f,
+  0x72, 0x74, 0x73, 0x01, 0x00, 0x00, 0x01, 0x04, 0x05, 0x69, 0x6e, 0x6e,
+  0x65, 0x72, 0x01, 0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x01, 0x01,
+  0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x03, 0x6c, 0x65,
+  0x74, 0x00, 0x01, 0x01, 0x04, 0x0b, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74,
+  0x73, 0x2d, 0x6d, 0x61, 0x70, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x01, 0x04, 0x07, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x73,
+  0x00, 0x00, 0x01, 0x01, 0x04, 0x10, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x69,
+  0x6d, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x01,
+  0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04, 0x07, 0x69, 0x6d, 0x70,
+  0x6f, 0x72, 0x74, 0x73, 0x00, 0x01, 0x04, 0x05, 0x69, 0x6e, 0x6e, 0x65,
+  0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x16, 0x6d, 0x61,
+  0x6b, 0x65, 0x2d, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x73, 0x2d, 0x6c,
+  0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x07, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x73, 0x01, 0x04, 0x05, 0x69, 0x6e, 0x6e,
+  0x65, 0x72, 0x00, 0x01, 0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x01,
+  0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x0a, 0x6c,
+  0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x00, 0x01, 0x04,
+  0x07, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x73, 0x01, 0x04, 0x05, 0x69,
+  0x6e, 0x6e, 0x65, 0x72, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x15, 0x6d,
+  0x61, 0x6b, 0x65, 0x2d, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x2d, 0x63,
+  0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x01, 0x04, 0x04, 0x6e,
+  0x61, 0x6d, 0x65, 0x00, 0x01, 0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74,
+  0x01, 0x04, 0x03, 0x65, 0x71, 0x3f, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75,
+  0x6f, 0x74, 0x65, 0x01, 0x04, 0x08, 0x73, 0x79, 0x6d, 0x2d, 0x6e, 0x61,
+  0x6d, 0x65, 0x00, 0x01, 0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x01,
+  0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x05, 0x71,
+  0x75, 0x6f, 0x74, 0x65, 0x00, 0x01, 0x04, 0x04, 0x6e, 0x61, 0x6d, 0x65,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x12, 0x6d, 0x61, 0x6b, 0x65,
+  0x2d, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x2d, 0x63, 0x61, 0x73,
+  0x65, 0x73, 0x01, 0x04, 0x07, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x73,
+  0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x04, 0x04, 0x6e,
+  0x69, 0x6c, 0x3f, 0x01, 0x04, 0x07, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74,
+  0x73, 0x00, 0x01, 0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x01, 0x01,
+  0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x05, 0x65, 0x72,
+  0x72, 0x6f, 0x72, 0x00, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74,
+  0x65, 0x01, 0x04, 0x08, 0x73, 0x79, 0x6d, 0x2d, 0x6e, 0x61, 0x6d, 0x65,
+  0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x01, 0x01,
+  0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x02, 0x69, 0x66,
+  0x00, 0x01, 0x01, 0x04, 0x15, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x65, 0x78,
+  0x70, 0x6f, 0x72, 0x74, 0x2d, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69,
+  0x6f, 0x6e, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01,
+  0x04, 0x07, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x00, 0x00, 0x01,
+  0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01, 0x04, 0x07, 0x65,
+  0x78, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x00, 0x01, 0x01, 0x04, 0x12, 0x6d,
+  0x61, 0x6b, 0x65, 0x2d, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x2d,
+  0x63, 0x61, 0x73, 0x65, 0x73, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73,
+  0x74, 0x01, 0x04, 0x07, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x13, 0x6d, 0x61, 0x6b,
+  0x65, 0x2d, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x2d, 0x6c, 0x61,
+  0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x07, 0x65, 0x78, 0x70, 0x6f, 0x72,
+  0x74, 0x73, 0x00, 0x01, 0x01, 0x04, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x01,
+  0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x06, 0x6c,
+  0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x01, 0x01, 0x04, 0x04, 0x6c, 0x69,
+  0x73, 0x74, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01,
+  0x04, 0x08, 0x73, 0x79, 0x6d, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00,
+  0x01, 0x01, 0x04, 0x12, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x65, 0x78, 0x70,
+  0x6f, 0x72, 0x74, 0x73, 0x2d, 0x63, 0x61, 0x73, 0x65, 0x73, 0x01, 0x04,
+  0x07, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x01, 0x04, 0x0e, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x2d,
+  0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x01, 0x04, 0x04, 0x66, 0x6f, 0x72,
+  0x6d, 0x00, 0x01, 0x01, 0x04, 0x0a, 0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d,
+  0x62, 0x64, 0x61, 0x73, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0b, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x04, 0x07,
+  0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x01, 0x04, 0x07, 0x64, 0x65,
+  0x66, 0x69, 0x6e, 0x65, 0x73, 0x01, 0x04, 0x07, 0x65, 0x78, 0x70, 0x6f,
+  0x72, 0x74, 0x73, 0x00, 0x01, 0x01, 0x04, 0x12, 0x6d, 0x61, 0x6b, 0x65,
+  0x2d, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x2d, 0x6c, 0x61, 0x6d, 0x62,
+  0x64, 0x61, 0x01, 0x01, 0x04, 0x10, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x6d,
+  0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x04,
+  0x07, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x01, 0x01, 0x04, 0x10,
+  0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x73,
+  0x2d, 0x6c, 0x65, 0x74, 0x01, 0x04, 0x07, 0x69, 0x6d, 0x70, 0x6f, 0x72,
+  0x74, 0x73, 0x01, 0x01, 0x04, 0x16, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x73, 0x2d, 0x6c, 0x65, 0x74, 0x6c, 0x61,
+  0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x07, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x65, 0x73, 0x01, 0x01, 0x04, 0x13, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x65,
+  0x78, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64,
+  0x61, 0x01, 0x01, 0x04, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01, 0x04,
+  0x07, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x01, 0x04, 0x0f, 0x63,
+  0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x2d, 0x69, 0x6d, 0x70, 0x6f, 0x72,
+  0x74, 0x73, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04,
+  0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0f, 0x63,
+  0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x2d, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x65, 0x73, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04,
+  0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0f, 0x63,
+  0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x2d, 0x65, 0x78, 0x70, 0x6f, 0x72,
+  0x74, 0x73, 0x01, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74, 0x01, 0x04,
+  0x04, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x04, 0x13, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x2d, 0x6d,
+  0x61, 0x63, 0x72, 0x6f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x01, 0x04,
+  0x07, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x00, 0x01, 0x01, 0x04,
+  0x0b, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64,
+  0x01, 0x04, 0x07, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x01, 0x01,
+  0x04, 0x08, 0x68, 0x61, 0x73, 0x68, 0x2d, 0x6d, 0x61, 0x70, 0x01, 0x01,
+  0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x06, 0x6c, 0x61,
+  0x6d, 0x62, 0x64, 0x61, 0x00, 0x01, 0x04, 0x0e, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x73, 0x73, 0x2d, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x01,
+  0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x03, 0x6c, 0x65,
+  0x74, 0x00, 0x01, 0x04, 0x0b, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73,
+  0x2d, 0x6c, 0x65, 0x74, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74,
+  0x65, 0x01, 0x04, 0x06, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x00, 0x01,
+  0x04, 0x0e, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x2d, 0x6d, 0x6f,
+  0x64, 0x75, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x09,
+  0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x01, 0x04, 0x07,
+  0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x00, 0x01, 0x01, 0x04, 0x13,
+  0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x2d, 0x6d, 0x61, 0x63, 0x72,
+  0x6f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x01, 0x04, 0x07, 0x70, 0x72,
+  0x6f, 0x67, 0x72, 0x61, 0x6d, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0a,
+  0x6c, 0x65, 0x74, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x73, 0x01, 0x01,
+  0x01, 0x01, 0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d,
+  0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x01, 0x04, 0x08, 0x73, 0x79, 0x6d,
+  0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x01, 0x01, 0x04, 0x02, 0x69, 0x66,
+  0x01, 0x01, 0x05, 0x08, 0x69, 0x73, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c,
+  0x01, 0x04, 0x08, 0x73, 0x79, 0x6d, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x01,
+  0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x09, 0x74,
+  0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x00, 0x01, 0x04,
+  0x09, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x01, 0x01,
+  0x04, 0x02, 0x69, 0x66, 0x01, 0x01, 0x05, 0x08, 0x69, 0x73, 0x5f, 0x65,
+  0x71, 0x75, 0x61, 0x6c, 0x01, 0x04, 0x08, 0x73, 0x79, 0x6d, 0x2d, 0x6e,
+  0x61, 0x6d, 0x65, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65,
+  0x01, 0x04, 0x13, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x2d, 0x6d,
+  0x61, 0x63, 0x72, 0x6f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x00, 0x00,
+  0x01, 0x04, 0x13, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x2d, 0x6d,
+  0x61, 0x63, 0x72, 0x6f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x01, 0x01,
+  0x04, 0x05, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x01, 0x04, 0x08, 0x73, 0x79,
+  0x6d, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61,
+  0x6d, 0x62, 0x64, 0x61, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0b,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01,
+  0x01, 0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x01, 0x01, 0x04, 0x05, 0x71,
+  0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x03, 0x65, 0x71, 0x3f, 0x00, 0x00,
+  0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x01, 0x01, 0x04, 0x05,
+  0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x04, 0x72, 0x65, 0x73, 0x74,
+  0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x01, 0x01,
+  0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x05, 0x66, 0x69,
+  0x72, 0x73, 0x74, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x72,
+  0x65, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04,
+  0x04, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63,
+  0x6f, 0x72, 0x65, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65,
+  0x01, 0x04, 0x01, 0x2b, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f,
+  0x72, 0x65, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01,
+  0x04, 0x04, 0x63, 0x74, 0x6f, 0x72, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04,
+  0x63, 0x6f, 0x72, 0x65, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74,
+  0x65, 0x01, 0x04, 0x08, 0x68, 0x61, 0x73, 0x68, 0x2d, 0x6d, 0x61, 0x70,
+  0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x63, 0x6f, 0x72, 0x65, 0x01, 0x01,
+  0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04, 0x0b, 0x6d, 0x61,
+  0x63, 0x72, 0x6f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0b, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x74, 0x01, 0x01, 0x04, 0x03, 0x65, 0x6e,
+  0x76, 0x01, 0x01, 0x04, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x01, 0x04,
+  0x04, 0x63, 0x6f, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x04, 0x0e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6c, 0x61,
+  0x6d, 0x62, 0x64, 0x61, 0x00
+};
@@ -5,7 +5,11 @@
 #include <string.h>
 #include <stdarg.h>
 
+#include "compile.h"
+#include "optimize.h"
 #include "serialize.h"
+#include "server.h"
+#include "reader.h"
 #include "vm.h"
 
 // #define ENABLE_DEBUG
@@ -55,6 +59,18 @@ int main(int argc, char** argv) {
   const char* file = 0;
   const char* serialize_to = 0;
   const char* deserialize_from = 0;
+  const char* compile_from = 0;
+  const char* output = 0;
+  const char* serve_path = 0;
+  const char* connect_path = 0;
+  const char* expression = 0;
+  ServerOptions server_options;
+  bool hash_cons = false;
+  bool optimize_code = true;
+  bool dump_optimized = false;
+  bool stream = false;
+  JitMode jit_mode = JitMode::On;
+  size_t memory_limit = 0;
 
 
   enum {
@@ -62,6 +78,13 @@ int main(int argc, char** argv) {
     TRANSFORM_FILE,
     SERIALIZE,
     DESERIALIZE,
+    COMPILE_C,
+    OUTPUT,
+    SERVE,
+    WORKERS,
+    CONNECT,
+    EXPRESSION,
+    MEMORY_LIMIT,
   } state = START;
 
   for(int i = 1; i < argc; i++) {
@@ -74,6 +97,37 @@ int main(int argc, char** argv) {
         state = SERIALIZE;
       } else if(strcmp(arg, "--deserialize") == 0) {
         state = DESERIALIZE;
+      } else if(strcmp(arg, "--compile-c") == 0) {
+        state = COMPILE_C;
+      } else if(strcmp(arg, "-o") == 0) {
+        state = OUTPUT;
+      } else if(strcmp(arg, "--serve") == 0) {
+        state = SERVE;
+      } else if(strcmp(arg, "--workers") == 0) {
+        state = WORKERS;
+      } else if(strcmp(arg, "--connect") == 0) {
+        state = CONNECT;
+      } else if(strcmp(arg, "--expr") == 0) {
+        state = EXPRESSION;
+      } else if(strcmp(arg, "--memory-limit") == 0) {
+        state = MEMORY_LIMIT;
+      } else if(strcmp(arg, "--hash-cons") == 0) {
+        hash_cons = true;
+      } else if(strcmp(arg, "--no-optimize") == 0) {
+        optimize_code = false;
+      } else if(strcmp(arg, "--stream") == 0) {
+        stream = true;
+      } else if(strcmp(arg, "--dump-optimized") == 0) {
+        dump_optimized = true;
+      } else if(strcmp(arg, "--jit=off") == 0) {
+        jit_mode = JitMode::Off;
+      } else if(strcmp(arg, "--jit=on") == 0) {
+        jit_mode = JitMode::On;
+      } else if(strcmp(arg, "--jit=always") == 0) {
+        jit_mode = JitMode::Always;
+      } else if(strncmp(arg, "--jit=", 6) == 0) {
+        fprintf(stderr, "--jit takes off, on or always\n");
+        return 1;
       } else {
         file = arg;
         state = START;
@@ -91,50 +145,140 @@ int main(int argc, char** argv) {
       deserialize_from = arg;
       state = START;
       break;
+    case COMPILE_C:
+      compile_from = arg;
+      state = START;
+      break;
+    case OUTPUT:
+      output = arg;
+      state = START;
+      break;
+    case SERVE:
+      serve_path = arg;
+      state = START;
+      break;
+    case WORKERS:
+      server_options.workers = strtoul(arg, 0, 10);
+      state = START;
+      break;
+    case CONNECT:
+      connect_path = arg;
+      state = START;
+      break;
+    case EXPRESSION:
+      expression = arg;
+      state = START;
+      break;
+    case MEMORY_LIMIT:
+      // In megabytes.
+      memory_limit = strtoul(arg, 0, 10) * 1024 * 1024;
+      state = START;
+      break;
     }
   }
   
+  // Clients don't need a VM of their own.
+  if(state == START && connect_path) {
+    if(!file == !expression) {
+      fprintf(stderr, "--connect needs either a file to run or --expr\n");
+      return 1;
+    }
+    char* text = expression ? 0 : loadBytes(file);
+    std::string response;
+    bool succeeded = server_request(connect_path,
+      expression ? RequestKind::Expression : RequestKind::Script,
+      String(expression ? expression : text), response);
+    free(text);
+    fwrite(response.data(), 1, response.size(), stdout);
+    return succeeded ? 0 : 1;
+  }
+
   VM vm;
+  vm.hashConsing = hash_cons;
+  vm.jitMode = jit_mode;
+  vm.setMemoryLimit(memory_limit);
 
-  if(state != START) {
-    fprintf(stderr, "couldn't parse arguments %d\n", state);
-  } else {
-    if(transform_file) {
-      if(file) {
-        fprintf(stderr, "can't provide both --transform-file and file to run\n");
-      } else {
-        Value transformed = run_transform_file(vm, transform_file);
-        if(serialize_to) {
-          String data = serialize(transformed);
-          saveBytes(serialize_to, data);
+  try {
+    if(state != START) {
+      fprintf(stderr, "couldn't parse arguments %d\n", state);
+    } else {
+      if(transform_file) {
+        if(file) {
+          fprintf(stderr, "can't provide both --transform-file and file to run\n");
         } else {
-          vm.print(transformed);
+          Value transformed = run_transform_file(vm, transform_file);
+          if(serialize_to) {
+            String data = serialize(transformed);
+            saveBytes(serialize_to, data);
+          } else {
+            vm.print(transformed);
+          }
+          return 0;
+        }
+      } else if(serve_path) {
+        if(server_options.workers == 0) {
+          fprintf(stderr, "--workers needs at least one worker\n");
+          return 1;
         }
+        server_options.optimize = optimize_code;
+        return serve(vm, serve_path, server_options);
+      } else if(compile_from) {
+        if(!output) {
+          fprintf(stderr, "--compile-c needs -o\n");
+          return 1;
+        }
+        Value transformed = run_transform_file(vm, compile_from);
+        if(optimize_code) {
+          transformed = optimize(vm, transformed, OptimizeOptions());
+        }
+        std::string code = compile_module(vm, transformed, compile_from);
+        saveBytes(output, String(code.data(), code.size()));
+        return 0;
+      } else if(serialize_to) {
+        Value value = parse_file(vm, file, false);
+        String data = serialize(value);
+        saveBytes(serialize_to, data);
+        return 0;
+      } else if(deserialize_from) {
+        const char* data = loadBytes(deserialize_from);
+        Value value = deserialize(vm, data);
+        vm.print(value);
         return 0;
+      } else if(file && stream) {
+        MappedFile source(file);
+        if(!source.data) {
+          perror(file);
+          return 1;
+        }
+        run_stream(vm, String(source.data, source.length), optimize_code);
+        return 0;
+      } else if(file) {
+        Value transformed = run_transform_file(vm, file);
+        if(optimize_code || dump_optimized) {
+          OptimizeStats stats;
+          transformed = optimize(vm, transformed, OptimizeOptions(), &stats);
+          if(dump_optimized) {
+            vm.print(transformed);
+            fprintf(stderr, "optimized in %zu passes: %zu beta reductions, %zu folds, %zu inlines, "
+              "%zu bindings removed, size %zu -> %zu\n",
+              stats.passes, stats.betaReductions, stats.folds, stats.inlines,
+              stats.removedBindings, stats.sizeBefore, stats.sizeAfter);
+            return 0;
+          }
+        }
+        Value moduleCall = vm.makeList(transformed, vm.objs.builtin_load_module);
+        Value module = eval(vm, moduleCall, vm.nil);
+        Value mainCall = vm.makeList(vm.makeList(module, vm.makeList(vm.syms.quote, vm.syms.main)));
+        Value result = eval(vm, mainCall, vm.nil);
+
+        vm.print(result);
+        return 0;
+      } else {
+        fprintf(stderr, "must provide either --transform-file or file to run\n");
       }
-    } else if(serialize_to) {
-      Value value = parse_file(vm, file, false);
-      String data = serialize(value);
-      saveBytes(serialize_to, data);
-      return 0;
-    } else if(deserialize_from) {
-      const char* data = loadBytes(deserialize_from);
-      Value value = deserialize(vm, data);
-      vm.print(value);
-      return 0;
-    } else if(file) {
-      Value transformed = run_transform_file(vm, file);
-      // vm.print(transformed);
-      Value moduleCall = vm.makeList(transformed, vm.objs.builtin_load_module);
-      Value module = eval(vm, moduleCall, vm.nil);
-      Value mainCall = vm.makeList(vm.makeList(module, vm.makeList(vm.syms.quote, vm.syms.main)));
-      Value result = eval(vm, mainCall, vm.nil);
-
-      vm.print(result);
-      return 0;
-    } else {
-      fprintf(stderr, "must provide either --transform-file or file to run\n");
     }
+  } catch(const VMError& error) {
+    error.print(stderr);
   }
   return 1;
 }
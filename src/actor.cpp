@@ -0,0 +1,295 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "actor.h"
+#include "builtin.h"
+#include "vector.h"
+#include "hashmap.h"
+#include "array.h"
+#include "memo.h"
+#include "compiled.h"
+#include "port.h"
+#include "vm.h"
+
+void Mailbox::push(Message message) {
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    messages.push_back(message);
+  }
+  arrived.notify_one();
+}
+
+Message Mailbox::pop() {
+  std::unique_lock<std::mutex> guard(lock);
+  arrived.wait(guard, [this] { return !messages.empty(); });
+  Message message = messages.front();
+  messages.pop_front();
+  return message;
+}
+
+ActorSystem::ActorSystem(VM& root) {
+  Actor* actor = new Actor();
+  actor->vm = 0;
+  actors.push_back(actor);
+}
+
+ActorSystem::~ActorSystem() {
+  for(size_t i = 0; ; i++) {
+    Actor* actor;
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      if(i >= actors.size()) {
+        break;
+      }
+      actor = actors[i];
+    }
+    if(actor->thread.joinable()) {
+      actor->thread.join();
+    }
+  }
+  for(size_t i = 0; i < actors.size(); i++) {
+    if(actors[i]->error && !actors[i]->reported) {
+      fprintf(stderr, "actor %zu failed:\n", i);
+      actors[i]->error->print(stderr);
+    }
+    delete actors[i]->error;
+    delete actors[i]->vm;
+    delete actors[i];
+  }
+}
+
+size_t ActorSystem::spawn(VM& vm, Value func) {
+  Actor* actor = new Actor();
+  actor->vm = new VM(*vm.root);
+  Value f = copyValue(*actor->vm, func);
+
+  std::lock_guard<std::mutex> guard(lock);
+  size_t id = actors.size();
+  actors.push_back(actor);
+  actor->vm->actorId = id;
+  actor->spawner = vm.actorId;
+  actor->thread = std::thread([this, actor, f] {
+    try {
+      apply(*actor->vm, f, actor->vm->nil);
+    } catch(const VMError& error) {
+      actor->error = new VMError(error);
+    }
+    actor->finished = true;
+    if(actor->error) {
+      Message message;
+      message.carrier = 0;
+      message.failed = actor;
+      Actor* spawner;
+      {
+        std::lock_guard<std::mutex> guard(lock);
+        spawner = actors[actor->spawner];
+      }
+      spawner->mailbox.push(message);
+    }
+  });
+  return id;
+}
+
+// Raises a failed actor's error in the actor that found out about it.
+[[noreturn]] static void raise_failure(Actor& actor) {
+  actor.reported = true;
+  VMError error = *actor.error;
+  error.message = "actor " + std::to_string(actor.vm->actorId) + " failed: " + error.message;
+  throw error;
+}
+
+bool ActorSystem::running() {
+  std::lock_guard<std::mutex> guard(lock);
+  for(size_t i = 1; i < actors.size(); i++) {
+    if(!actors[i]->finished) {
+      return true;
+    }
+  }
+  return false;
+}
+
+Actor& ActorSystem::get(VM& vm, size_t id) {
+  std::lock_guard<std::mutex> guard(lock);
+  VM_EXPECT(vm, id < actors.size());
+  return *actors[id];
+}
+
+class Copier {
+public:
+  VM& vm;
+  std::unordered_map<Object*, Object*> seen;
+
+  Copier(VM& vm): vm(vm) {}
+
+  bool shared(Value value) {
+    switch(value->type()) {
+    case Object::Type::Nil:
+    case Object::Type::Bool:
+    case Object::Type::Symbol:
+    case Object::Type::Builtin:
+      return true;
+    default:
+      return vm.isFrozen(value);
+    }
+  }
+
+  Value copy(Value value) {
+    if(shared(value)) {
+      return value;
+    }
+    auto it = seen.find(value.getObj());
+    if(it != seen.end()) {
+      return it->second;
+    }
+    switch(value->type()) {
+    case Object::Type::Integer:
+      return vm.makeInteger(value.asIntegerUnsafe());
+    case Object::Type::String:
+      return vm.copyString(value.asStringUnsafe());
+    case Object::Type::Cons: {
+      // Walk the spine iteratively so long lists don't exhaust the stack.
+      Value head = vm.makeFreshCons(vm.nil, vm.nil);
+      seen[value.getObj()] = head.getObj();
+      Value cell = head;
+      while(true) {
+        cell->as_cons.first = copy(value->as_cons.first);
+        Value rest = value->as_cons.rest;
+        if(!rest.isCons() || shared(rest) || seen.count(rest.getObj())) {
+          cell->as_cons.rest = copy(rest);
+          return head;
+        }
+        Value next = vm.makeFreshCons(vm.nil, vm.nil);
+        seen[rest.getObj()] = next.getObj();
+        cell->as_cons.rest = next;
+        cell = next;
+        value = rest;
+      }
+    }
+    case Object::Type::Lambda: {
+      Value lambda = make_lambda(vm, vm.nil, vm.nil, vm.nil);
+      seen[value.getObj()] = lambda.getObj();
+      lambda->as_lambda.params = copy(value->as_lambda.params);
+      lambda->as_lambda.body = copy(value->as_lambda.body);
+      lambda->as_lambda.env = copy(value->as_lambda.env);
+      lambda->as_lambda.frameEscapes = value->as_lambda.frameEscapes;
+      return lambda;
+    }
+    case Object::Type::Compiled: {
+      const Compiled& c = value.asCompiledUnsafe();
+      size_t count = compiled_captures(value);
+      Value closure = make_compiled(vm, c.name, c.func, count, c.constants);
+      seen[value.getObj()] = closure.getObj();
+      for(size_t i = 0; i < count; i++) {
+        closure->as_compiled.captured[i] = copy(c.captured[i]);
+      }
+      return closure;
+    }
+    case Object::Type::Vector: {
+      const Vector& v = value.asVectorUnsafe();
+      std::vector<Value> items;
+      for(size_t i = 0; i < v.length; i++) {
+        items.push_back(copy(vector_get(v, i)));
+      }
+      Value vector = make_vector(vm, items.data(), items.size());
+      seen[value.getObj()] = vector.getObj();
+      return vector;
+    }
+    case Object::Type::HashMap: {
+      Value map = make_hashmap(vm);
+      hashmap_for_each(value, [this, &map](Value key, Value item) {
+        map = hashmap_assoc(vm, map, copy(key), copy(item));
+      });
+      seen[value.getObj()] = map.getObj();
+      return map;
+    }
+    case Object::Type::Array: {
+      const Array& a = value.asArrayUnsafe();
+      Value array = make_array(vm, a.length);
+      memcpy(array.asArrayUnsafe().data, a.data, sizeof(int64_t) * a.length);
+      seen[value.getObj()] = array.getObj();
+      return array;
+    }
+    case Object::Type::Port: {
+      // Ports belong to the root, so the copy refers to the same one.
+      Value port = make_port(vm, value->as_port);
+      seen[value.getObj()] = port.getObj();
+      return port;
+    }
+    case Object::Type::Memoized: {
+      // The copy starts with an empty cache of its own.
+      const Memoized& m = value.asMemoizedUnsafe();
+      Value memoized = make_memoized(vm, copy(m.func), m.cache->capacity);
+      seen[value.getObj()] = memoized.getObj();
+      return memoized;
+    }
+    default:
+      EXPECT(0);
+      return 0;
+    }
+  }
+};
+
+Value copyValue(VM& vm, Value value) {
+  Copier copier(vm);
+  return copier.copy(value);
+}
+
+Value builtin_spawn(VM& vm, const Value* args, size_t n) {
+  Value func = singleValue(vm, args, n);
+  return vm.makeInteger(vm.actorSystem().spawn(vm, func));
+}
+
+// Frozen values are passed by pointer; anything else is copied into a
+// carrier heap that the receiver adopts.
+Value builtin_send(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2);
+  int id = args[0].asInteger(vm);
+  VM_EXPECT(vm, id >= 0);
+  Value value = args[1];
+
+  Message message;
+  if(vm.isFrozen(value)) {
+    message.value = value;
+    message.carrier = 0;
+  } else {
+    message.carrier = new VM(*vm.root);
+    message.value = copyValue(*message.carrier, value);
+  }
+  Actor& actor = vm.actorSystem().get(vm, id);
+  if(actor.finished && actor.error) {
+    delete message.carrier;
+    raise_failure(actor);
+  }
+  actor.mailbox.push(message);
+  return value;
+}
+
+Value builtin_receive(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 0);
+  Message message = vm.actorSystem().get(vm, vm.actorId).mailbox.pop();
+  if(message.failed) {
+    raise_failure(*message.failed);
+  }
+  if(message.carrier) {
+    vm.adoptHeap(*message.carrier);
+    delete message.carrier;
+  }
+  return message.value;
+}
+
+Value builtin_self(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 0);
+  return vm.makeInteger(vm.actorId);
+}
+
+Value builtin_freeze(VM& vm, const Value* args, size_t n) {
+  Value value = singleValue(vm, args, n);
+  VM carrier(*vm.root);
+  Value frozen = copyValue(carrier, value);
+  vm.freezeHeap(carrier);
+  return frozen;
+}
@@ -0,0 +1,83 @@
+#ifndef MYLISP_ACTOR_H_
+#define MYLISP_ACTOR_H_
+
+#include <stddef.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "value.h"
+
+class Actor;
+class VMError;
+
+class Message {
+public:
+  Value value;
+
+  // Owns the heap the value was copied into, or null if the value was
+  // frozen and is being shared by pointer.
+  VM* carrier;
+
+  // Set instead of a value when an actor the receiver spawned failed, for
+  // receive to raise its error.
+  Actor* failed = 0;
+};
+
+class Mailbox {
+public:
+  std::mutex lock;
+  std::condition_variable arrived;
+  std::deque<Message> messages;
+
+  void push(Message message);
+  Message pop();
+};
+
+class Actor {
+public:
+  // Null for the root VM, which has a mailbox but no thread of its own.
+  VM* vm;
+  std::thread thread;
+  Mailbox mailbox;
+  std::atomic<bool> finished{false};
+
+  // The actor that spawned this one, which is told if it fails.
+  size_t spawner = 0;
+
+  // What the actor's function raised, if anything, and whether that has
+  // been raised again in another actor.
+  VMError* error = 0;
+  bool reported = false;
+};
+
+// Actors are numbered in spawn order, the root being actor 0.  They must run
+// to completion: the root VM joins all of them when it is destroyed.  An
+// actor that raises an error stops, and the error is raised again by its
+// spawner's next receive, or by a send to it.  Errors nobody saw are
+// printed when the actors are joined.
+class ActorSystem {
+private:
+  std::mutex lock;
+  std::vector<Actor*> actors;
+
+public:
+  ActorSystem(VM& root);
+  ~ActorSystem();
+
+  size_t spawn(VM& vm, Value func);
+  Actor& get(VM& vm, size_t id);
+
+  // Whether any actor's function hasn't returned yet.
+  bool running();
+};
+
+// Copies `value` into `vm`'s heap, sharing frozen structure, symbols and
+// builtins by pointer.  Cycles created by letlambdas are preserved.
+Value copyValue(VM& vm, Value value);
+
+#endif
@@ -0,0 +1,388 @@
+#include <limits.h>
+#include <string.h>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "array.h"
+#include "builtin.h"
+#include "vm.h"
+
+class ArrayKernels {
+public:
+  void (*add)(const int64_t* a, const int64_t* b, int64_t* out, size_t n);
+  void (*mul)(const int64_t* a, const int64_t* b, int64_t* out, size_t n);
+  void (*less)(const int64_t* a, const int64_t* b, int64_t* out, size_t n);
+  int64_t (*sum)(const int64_t* a, size_t n);
+  int64_t (*dot)(const int64_t* a, const int64_t* b, size_t n);
+  int64_t (*min)(const int64_t* a, size_t n);
+  int64_t (*max)(const int64_t* a, size_t n);
+};
+
+// Arithmetic wraps around, so it is done on unsigned values to keep the
+// scalar and vector kernels in agreement.
+static inline int64_t wrap_add(int64_t a, int64_t b) {
+  return (int64_t)((uint64_t)a + (uint64_t)b);
+}
+
+static inline int64_t wrap_mul(int64_t a, int64_t b) {
+  return (int64_t)((uint64_t)a * (uint64_t)b);
+}
+
+static void scalar_add(const int64_t* a, const int64_t* b, int64_t* out, size_t n) {
+  for(size_t i = 0; i < n; i++) {
+    out[i] = wrap_add(a[i], b[i]);
+  }
+}
+
+static void scalar_mul(const int64_t* a, const int64_t* b, int64_t* out, size_t n) {
+  for(size_t i = 0; i < n; i++) {
+    out[i] = wrap_mul(a[i], b[i]);
+  }
+}
+
+static void scalar_less(const int64_t* a, const int64_t* b, int64_t* out, size_t n) {
+  for(size_t i = 0; i < n; i++) {
+    out[i] = a[i] < b[i] ? 1 : 0;
+  }
+}
+
+static int64_t scalar_sum(const int64_t* a, size_t n) {
+  int64_t sum = 0;
+  for(size_t i = 0; i < n; i++) {
+    sum = wrap_add(sum, a[i]);
+  }
+  return sum;
+}
+
+static int64_t scalar_dot(const int64_t* a, const int64_t* b, size_t n) {
+  int64_t sum = 0;
+  for(size_t i = 0; i < n; i++) {
+    sum = wrap_add(sum, wrap_mul(a[i], b[i]));
+  }
+  return sum;
+}
+
+static int64_t scalar_min(const int64_t* a, size_t n) {
+  int64_t result = a[0];
+  for(size_t i = 1; i < n; i++) {
+    result = a[i] < result ? a[i] : result;
+  }
+  return result;
+}
+
+static int64_t scalar_max(const int64_t* a, size_t n) {
+  int64_t result = a[0];
+  for(size_t i = 1; i < n; i++) {
+    result = a[i] > result ? a[i] : result;
+  }
+  return result;
+}
+
+static const ArrayKernels scalarKernels = {
+  scalar_add, scalar_mul, scalar_less, scalar_sum, scalar_dot, scalar_min, scalar_max
+};
+
+#if defined(__x86_64__)
+
+#define AVX2 __attribute__((target("avx2")))
+
+static const size_t lanes = 4;
+
+static inline AVX2 __m256i load(const int64_t* p) {
+  return _mm256_loadu_si256((const __m256i*)p);
+}
+
+static inline AVX2 void store(int64_t* p, __m256i v) {
+  _mm256_storeu_si256((__m256i*)p, v);
+}
+
+// AVX2 has no 64-bit multiply; build the low 64 bits of the product out of
+// 32x32 -> 64 bit multiplies.
+static inline AVX2 __m256i mul64(__m256i a, __m256i b) {
+  __m256i low = _mm256_mul_epu32(a, b);
+  __m256i cross = _mm256_add_epi64(
+    _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+    _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+  return _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));
+}
+
+static inline AVX2 int64_t horizontal_sum(__m256i v) {
+  int64_t parts[lanes];
+  store(parts, v);
+  return wrap_add(wrap_add(parts[0], parts[1]), wrap_add(parts[2], parts[3]));
+}
+
+static AVX2 void avx2_add(const int64_t* a, const int64_t* b, int64_t* out, size_t n) {
+  size_t i = 0;
+  for(; i + lanes <= n; i += lanes) {
+    store(out + i, _mm256_add_epi64(load(a + i), load(b + i)));
+  }
+  scalar_add(a + i, b + i, out + i, n - i);
+}
+
+static AVX2 void avx2_mul(const int64_t* a, const int64_t* b, int64_t* out, size_t n) {
+  size_t i = 0;
+  for(; i + lanes <= n; i += lanes) {
+    store(out + i, mul64(load(a + i), load(b + i)));
+  }
+  scalar_mul(a + i, b + i, out + i, n - i);
+}
+
+static AVX2 void avx2_less(const int64_t* a, const int64_t* b, int64_t* out, size_t n) {
+  __m256i one = _mm256_set1_epi64x(1);
+  size_t i = 0;
+  for(; i + lanes <= n; i += lanes) {
+    store(out + i, _mm256_and_si256(_mm256_cmpgt_epi64(load(b + i), load(a + i)), one));
+  }
+  scalar_less(a + i, b + i, out + i, n - i);
+}
+
+static AVX2 int64_t avx2_sum(const int64_t* a, size_t n) {
+  __m256i acc = _mm256_setzero_si256();
+  size_t i = 0;
+  for(; i + lanes <= n; i += lanes) {
+    acc = _mm256_add_epi64(acc, load(a + i));
+  }
+  return wrap_add(horizontal_sum(acc), scalar_sum(a + i, n - i));
+}
+
+static AVX2 int64_t avx2_dot(const int64_t* a, const int64_t* b, size_t n) {
+  __m256i acc = _mm256_setzero_si256();
+  size_t i = 0;
+  for(; i + lanes <= n; i += lanes) {
+    acc = _mm256_add_epi64(acc, mul64(load(a + i), load(b + i)));
+  }
+  return wrap_add(horizontal_sum(acc), scalar_dot(a + i, b + i, n - i));
+}
+
+static AVX2 int64_t avx2_min(const int64_t* a, size_t n) {
+  if(n < lanes) {
+    return scalar_min(a, n);
+  }
+  __m256i acc = load(a);
+  size_t i = lanes;
+  for(; i + lanes <= n; i += lanes) {
+    __m256i v = load(a + i);
+    acc = _mm256_blendv_epi8(acc, v, _mm256_cmpgt_epi64(acc, v));
+  }
+  int64_t parts[lanes];
+  store(parts, acc);
+  int64_t result = scalar_min(parts, lanes);
+  if(i < n) {
+    int64_t rest = scalar_min(a + i, n - i);
+    result = rest < result ? rest : result;
+  }
+  return result;
+}
+
+static AVX2 int64_t avx2_max(const int64_t* a, size_t n) {
+  if(n < lanes) {
+    return scalar_max(a, n);
+  }
+  __m256i acc = load(a);
+  size_t i = lanes;
+  for(; i + lanes <= n; i += lanes) {
+    __m256i v = load(a + i);
+    acc = _mm256_blendv_epi8(acc, v, _mm256_cmpgt_epi64(v, acc));
+  }
+  int64_t parts[lanes];
+  store(parts, acc);
+  int64_t result = scalar_max(parts, lanes);
+  if(i < n) {
+    int64_t rest = scalar_max(a + i, n - i);
+    result = rest > result ? rest : result;
+  }
+  return result;
+}
+
+static const ArrayKernels avx2Kernels = {
+  avx2_add, avx2_mul, avx2_less, avx2_sum, avx2_dot, avx2_min, avx2_max
+};
+
+static const ArrayKernels& select_kernels() {
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports("avx2")) {
+    return avx2Kernels;
+  }
+  return scalarKernels;
+}
+
+#else
+
+static const ArrayKernels& select_kernels() {
+  return scalarKernels;
+}
+
+#endif
+
+static const ArrayKernels& kernels() {
+  static const ArrayKernels& selected = select_kernels();
+  return selected;
+}
+
+Value make_array(VM& vm, size_t length) {
+  Value o = new(vm, Object::Type::Array) Object;
+  Array& a = o.asArrayUnsafe();
+  a.length = length;
+  a.data = (int64_t*)vm.alloc(sizeof(int64_t) * length);
+  return o;
+}
+
+Value array_from_list(VM& vm, Value list) {
+  Value array = make_array(vm, list_length(list));
+  int64_t* data = array.asArrayUnsafe().data;
+  while(!list.isNil()) {
+    Cons c = list.asCons(vm);
+    *(data++) = c.first.asInteger(vm);
+    list = c.rest;
+  }
+  return array;
+}
+
+Value array_to_list(VM& vm, Value array) {
+  const Array& a = array.asArray(vm);
+  Value list = vm.nil;
+  for(size_t i = a.length; i > 0; i--) {
+    VM_EXPECT(vm, a.data[i - 1] >= INT_MIN && a.data[i - 1] <= INT_MAX);
+    list = vm.makeCons(vm.makeInteger((int)a.data[i - 1]), list);
+  }
+  return list;
+}
+
+typedef void (*ElementwiseKernel)(const int64_t* a, const int64_t* b, int64_t* out, size_t n);
+
+static Value elementwise(VM& vm, Value a, Value b, ElementwiseKernel kernel) {
+  const Array& x = a.asArray(vm);
+  const Array& y = b.asArray(vm);
+  VM_EXPECT(vm, x.length == y.length);
+  Value result = make_array(vm, x.length);
+  kernel(x.data, y.data, result.asArrayUnsafe().data, x.length);
+  return result;
+}
+
+Value array_add(VM& vm, Value a, Value b) {
+  return elementwise(vm, a, b, kernels().add);
+}
+
+Value array_mul(VM& vm, Value a, Value b) {
+  return elementwise(vm, a, b, kernels().mul);
+}
+
+Value array_less(VM& vm, Value a, Value b) {
+  return elementwise(vm, a, b, kernels().less);
+}
+
+int64_t array_sum(VM& vm, Value array) {
+  const Array& a = array.asArray(vm);
+  return kernels().sum(a.data, a.length);
+}
+
+int64_t array_dot(VM& vm, Value a, Value b) {
+  const Array& x = a.asArray(vm);
+  const Array& y = b.asArray(vm);
+  VM_EXPECT(vm, x.length == y.length);
+  return kernels().dot(x.data, y.data, x.length);
+}
+
+int64_t array_min(VM& vm, Value array) {
+  const Array& a = array.asArray(vm);
+  VM_EXPECT(vm, a.length > 0);
+  return kernels().min(a.data, a.length);
+}
+
+int64_t array_max(VM& vm, Value array) {
+  const Array& a = array.asArray(vm);
+  VM_EXPECT(vm, a.length > 0);
+  return kernels().max(a.data, a.length);
+}
+
+// Integers are 32 bits wide, so reductions that leave that range are errors
+// rather than silently truncated.
+static Value make_result(VM& vm, int64_t value) {
+  VM_EXPECT(vm, value >= INT_MIN && value <= INT_MAX);
+  return vm.makeInteger((int)value);
+}
+
+static void two_arrays(VM& vm, const Value* args, size_t n, Value& a, Value& b) {
+  VM_EXPECT(vm, n == 2);
+  a = args[0];
+  b = args[1];
+}
+
+Value builtin_array(VM& vm, const Value* args, size_t n) {
+  Value array = make_array(vm, n);
+  int64_t* data = array.asArrayUnsafe().data;
+  for(size_t i = 0; i < n; i++) {
+    data[i] = args[i].asInteger(vm);
+  }
+  return array;
+}
+
+Value builtin_list_to_array(VM& vm, const Value* args, size_t n) {
+  return array_from_list(vm, singleValue(vm, args, n));
+}
+
+Value builtin_array_to_list(VM& vm, const Value* args, size_t n) {
+  return array_to_list(vm, singleValue(vm, args, n));
+}
+
+Value builtin_array_range(VM& vm, const Value* args, size_t n) {
+  int length = singleValue(vm, args, n).asInteger(vm);
+  VM_EXPECT(vm, length >= 0);
+  Value array = make_array(vm, length);
+  int64_t* data = array.asArrayUnsafe().data;
+  for(int i = 0; i < length; i++) {
+    data[i] = i;
+  }
+  return array;
+}
+
+Value builtin_array_length(VM& vm, const Value* args, size_t n) {
+  return make_result(vm, singleValue(vm, args, n).asArray(vm).length);
+}
+
+Value builtin_array_ref(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2);
+  const Array& a = args[0].asArray(vm);
+  int index = args[1].asInteger(vm);
+  VM_EXPECT(vm, index >= 0 && (size_t)index < a.length);
+  return make_result(vm, a.data[index]);
+}
+
+Value builtin_array_add(VM& vm, const Value* args, size_t n) {
+  Value a, b;
+  two_arrays(vm, args, n, a, b);
+  return array_add(vm, a, b);
+}
+
+Value builtin_array_mul(VM& vm, const Value* args, size_t n) {
+  Value a, b;
+  two_arrays(vm, args, n, a, b);
+  return array_mul(vm, a, b);
+}
+
+Value builtin_array_less(VM& vm, const Value* args, size_t n) {
+  Value a, b;
+  two_arrays(vm, args, n, a, b);
+  return array_less(vm, a, b);
+}
+
+Value builtin_array_sum(VM& vm, const Value* args, size_t n) {
+  return make_result(vm, array_sum(vm, singleValue(vm, args, n)));
+}
+
+Value builtin_array_dot(VM& vm, const Value* args, size_t n) {
+  Value a, b;
+  two_arrays(vm, args, n, a, b);
+  return make_result(vm, array_dot(vm, a, b));
+}
+
+Value builtin_array_min(VM& vm, const Value* args, size_t n) {
+  return make_result(vm, array_min(vm, singleValue(vm, args, n)));
+}
+
+Value builtin_array_max(VM& vm, const Value* args, size_t n) {
+  return make_result(vm, array_max(vm, singleValue(vm, args, n)));
+}
@@ -0,0 +1,32 @@
+#ifndef MYLISP_ARRAY_H_
+#define MYLISP_ARRAY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "value.h"
+
+// Arrays are unboxed, fixed-length runs of 64-bit integers.  The bulk
+// operations run on AVX2 kernels when the CPU has them and on plain loops
+// otherwise.
+Value make_array(VM& vm, size_t length);
+
+Value array_from_list(VM& vm, Value list);
+
+Value array_to_list(VM& vm, Value array);
+
+Value array_add(VM& vm, Value a, Value b);
+
+Value array_mul(VM& vm, Value a, Value b);
+
+Value array_less(VM& vm, Value a, Value b);
+
+int64_t array_sum(VM& vm, Value array);
+
+int64_t array_dot(VM& vm, Value a, Value b);
+
+int64_t array_min(VM& vm, Value array);
+
+int64_t array_max(VM& vm, Value array);
+
+#endif
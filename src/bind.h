@@ -0,0 +1,144 @@
+#ifndef MYLISP_BIND_H_
+#define MYLISP_BIND_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#include "vm.h"
+
+// Turns an ordinary function into a builtin: BIND_BUILTIN(f) is a
+// BuiltinFunc that checks the argument count, unboxes each argument to the
+// type of the matching parameter and boxes the result.  A first parameter
+// of type VM& is passed the calling VM instead of an argument.
+//
+// Supported parameter and result types are integers, bool, String and
+// Value; a void function returns ().
+#define BIND_BUILTIN(func) (&BoundBuiltin<decltype(&func), &func>::call)
+
+template<class T, class Enable = void>
+class BuiltinType;
+
+template<class T>
+class BuiltinType<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type> {
+public:
+  static T from(VM& vm, Value value) {
+    int i = value.asInteger(vm);
+    VM_EXPECT(vm, fits<T>(i));
+    return (T)i;
+  }
+
+  static Value to(VM& vm, T value) {
+    VM_EXPECT(vm, fits<int>(value));
+    return vm.makeInteger((int)value);
+  }
+
+private:
+  template<class From>
+  static bool negative(From value, std::true_type) { return value < 0; }
+  template<class From>
+  static bool negative(From value, std::false_type) { return false; }
+
+  template<class To, class From>
+  static bool fits(From value) {
+    if(negative(value, std::is_signed<From>())) {
+      return std::is_signed<To>::value &&
+        (int64_t)value >= (int64_t)std::numeric_limits<To>::min();
+    }
+    return (uint64_t)value <= (uint64_t)std::numeric_limits<To>::max();
+  }
+};
+
+template<>
+class BuiltinType<bool> {
+public:
+  static bool from(VM& vm, Value value) { return value.asBool(vm); }
+  static Value to(VM& vm, bool value) { return vm.makeBool(value); }
+};
+
+// Strings passed in share the bytes of the argument; strings returned are
+// copied, since they may point into the caller's own storage.
+template<>
+class BuiltinType<String> {
+public:
+  static String from(VM& vm, Value value) { return value.asString(vm); }
+  static Value to(VM& vm, const String& value) { return vm.copyString(value); }
+};
+
+template<>
+class BuiltinType<Value> {
+public:
+  static Value from(VM& vm, Value value) { return value; }
+  static Value to(VM& vm, Value value) { return value; }
+};
+
+template<size_t... I>
+class BuiltinIndices {};
+
+template<size_t N, size_t... I>
+class MakeBuiltinIndices: public MakeBuiltinIndices<N - 1, N - 1, I...> {};
+
+template<size_t... I>
+class MakeBuiltinIndices<0, I...> {
+public:
+  typedef BuiltinIndices<I...> type;
+};
+
+template<class R>
+class BuiltinResult {
+public:
+  template<class F, class... Args>
+  static Value call(VM& vm, F func, Args... args) {
+    return BuiltinType<typename std::decay<R>::type>::to(vm, func(args...));
+  }
+};
+
+template<>
+class BuiltinResult<void> {
+public:
+  template<class F, class... Args>
+  static Value call(VM& vm, F func, Args... args) {
+    func(args...);
+    return vm.nil;
+  }
+};
+
+template<class F, F func>
+class BoundBuiltin;
+
+template<class R, class... Params, R (*func)(Params...)>
+class BoundBuiltin<R (*)(Params...), func> {
+public:
+  static Value call(VM& vm, const Value* args, size_t n) {
+    VM_EXPECT(vm, n == sizeof...(Params));
+    return unpack(vm, args, typename MakeBuiltinIndices<sizeof...(Params)>::type());
+  }
+
+private:
+  template<size_t... I>
+  static Value unpack(VM& vm, const Value* args, BuiltinIndices<I...>) {
+    return BuiltinResult<R>::call(vm, func,
+      BuiltinType<typename std::decay<Params>::type>::from(vm, args[I])...);
+  }
+};
+
+template<class R, class... Params, R (*func)(VM&, Params...)>
+class BoundBuiltin<R (*)(VM&, Params...), func> {
+public:
+  static Value call(VM& vm, const Value* args, size_t n) {
+    VM_EXPECT(vm, n == sizeof...(Params));
+    return unpack(vm, args, typename MakeBuiltinIndices<sizeof...(Params)>::type());
+  }
+
+private:
+  template<size_t... I>
+  static Value unpack(VM& vm, const Value* args, BuiltinIndices<I...>) {
+    return BuiltinResult<R>::call(vm, func, std::ref(vm),
+      BuiltinType<typename std::decay<Params>::type>::from(vm, args[I])...);
+  }
+};
+
+#endif
@@ -1,104 +1,91 @@
+#include <vector>
+
 #include "builtin.h"
 #include "vm.h"
 #include "serialize.h"
 #include "string.h"
+#include "text.h"
 
-Value builtin_add(VM& vm, Value args) {
+Value builtin_add(VM& vm, const Value* args, size_t n) {
   int res = 0;
-  while(!args.isNil()) {
-    Cons c = args.asCons(vm);
-    res += c.first.asInteger(vm);
-    args = c.rest;
+  for(size_t i = 0; i < n; i++) {
+    res += args[i].asInteger(vm);
   }
   return vm.makeInteger(res);
 }
 
-Value builtin_sub(VM& vm, Value args) {
-  int res;
-  if(!args.isNil()) {
-    Cons c = args.asCons(vm);
-    int i = c.first.asInteger(vm);
-    args = c.rest;
-    if(args.isNil()) {
-      return vm.makeInteger(-i);
-    }
-    res = i;
+Value builtin_sub(VM& vm, const Value* args, size_t n) {
+  if(n == 0) {
+    return vm.makeInteger(0);
+  }
+  int res = args[0].asInteger(vm);
+  if(n == 1) {
+    return vm.makeInteger(-res);
   }
-  while(!args.isNil()) {
-    Cons c = args.asCons(vm);
-    res -= c.first.asInteger(vm);
-    args = c.rest;
+  for(size_t i = 1; i < n; i++) {
+    res -= args[i].asInteger(vm);
   }
   return vm.makeInteger(res);
 }
 
-Value builtin_mul(VM& vm, Value args) {
+Value builtin_mul(VM& vm, const Value* args, size_t n) {
   int res = 1;
-  while(!args.isNil()) {
-    Cons c = args.asCons(vm);
-    res *= c.first.asInteger(vm);
-    args = c.rest;
+  for(size_t i = 0; i < n; i++) {
+    res *= args[i].asInteger(vm);
   }
   return vm.makeInteger(res);
 }
 
-Value builtin_div(VM& vm, Value args) {
-  Cons c = args.asCons(vm);
-  int res = c.first.asInteger(vm);
-  args = c.rest;
-  while(!args.isNil()) {
-    c = args.asCons(vm);
-    res /= c.first.asInteger(vm);
-    args = c.rest;
+// Dividing by -1 negates, wrapping around like the other operators instead
+// of trapping on INT_MIN.
+static int divide(VM& vm, int a, int b, bool modulo) {
+  if(b == 0) {
+    VM_ERROR(vm, "division by zero");
+  } else if(b == -1) {
+    return modulo ? 0 : (int)(0u - (unsigned)a);
   }
-  return vm.makeInteger(res);
+  return modulo ? a % b : a / b;
 }
 
-template<class Func>
-static Value expandArgs2(VM& vm, Value args, Func func) {
-  Cons c = args.asCons(vm);
-  Value a = c.first;
-  c = c.rest.asCons(vm);
-  Value b = c.first;
-  VM_EXPECT(vm, c.rest.isNil());
-  return func(a, b);
+Value builtin_div(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n >= 1);
+  int res = args[0].asInteger(vm);
+  for(size_t i = 1; i < n; i++) {
+    res = divide(vm, res, args[i].asInteger(vm), false);
+  }
+  return vm.makeInteger(res);
 }
 
-Value singleValue(VM& vm, Value args) {
-  Cons c = args.asCons(vm);
-  VM_EXPECT(vm, c.rest.isNil());
-  return c.first;
+Value singleValue(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 1);
+  return args[0];
 }
 
-Value builtin_modulo(VM& vm, Value args) {
-  return expandArgs2(vm, args, [&vm] (Value a, Value b) {
-    return vm.makeInteger(
-      a.asInteger(vm) % b.asInteger(vm));
-  });
+Value builtin_modulo(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2);
+  return vm.makeInteger(divide(vm, args[0].asInteger(vm), args[1].asInteger(vm), true));
 }
 
-Value builtin_cons(VM& vm, Value args) {
-  return expandArgs2(vm, args, [&vm] (Value first, Value rest) {
-    return vm.makeCons(first, rest);
-  });
+Value builtin_cons(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2);
+  return vm.makeCons(args[0], args[1]);
 }
 
-Value builtin_first(VM& vm, Value args) {
-  return singleValue(vm, args).asCons(vm).first;
+Value builtin_first(VM& vm, const Value* args, size_t n) {
+  return singleValue(vm, args, n).asCons(vm).first;
 }
 
-Value builtin_rest(VM& vm, Value args) {
-  return singleValue(vm, args).asCons(vm).rest;
+Value builtin_rest(VM& vm, const Value* args, size_t n) {
+  return singleValue(vm, args, n).asCons(vm).rest;
 }
 
-Value builtin_is_equal(VM& vm, Value args) {
-  return expandArgs2(vm, args, [&vm] (Value a, Value b) {
-    return vm.makeBool(a == b);
-  });
+Value builtin_is_equal(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2);
+  return vm.makeBool(args[0] == args[1]);
 }
 
-Value builtin_constructor(VM& vm, Value args) {
-  switch(singleValue(vm, args)->type) {
+Value builtin_constructor(VM& vm, const Value* args, size_t n) {
+  switch(singleValue(vm, args, n)->type()) {
   case Object::Type::Nil:       return vm.syms.Nil;
   case Object::Type::Cons:      return vm.syms.Cons;
   case Object::Type::String:    return vm.syms.String;
@@ -107,64 +94,75 @@ Value builtin_constructor(VM& vm, Value args) {
   case Object::Type::Builtin:   return vm.syms.Builtin;
   case Object::Type::Bool:      return vm.syms.Bool;
   case Object::Type::Lambda:    return vm.syms.Lambda;
+  case Object::Type::Vector:    return vm.syms.Vector;
+  case Object::Type::HashMap:   return vm.syms.HashMap;
+  case Object::Type::Array:     return vm.syms.Array;
+  case Object::Type::Memoized:  return vm.syms.Memoized;
+  case Object::Type::Compiled:  return vm.syms.Lambda;
+  case Object::Type::Port:      return vm.syms.Port;
   default:
     EXPECT(0);
     return 0;
   }
 }
 
-Value builtin_concat(VM& vm, Value args) {
-  StringBuffer buf;
-  while(!args.isNil()) {
-    Cons c = args.asCons(vm);
-    buf.append(c.first.asString(vm));
-    args = c.rest;
+Value builtin_concat(VM& vm, const Value* args, size_t n) {
+  // Most calls have a handful of arguments; only spill to the C++ heap for
+  // long ones.
+  String local[8];
+  std::vector<String> spilled;
+  String* parts = local;
+  if(n > 8) {
+    spilled.resize(n);
+    parts = spilled.data();
+  }
+  for(size_t i = 0; i < n; i++) {
+    parts[i] = args[i].asString(vm);
   }
-  return vm.makeString(buf.str());
+  return vm.makeString(text_concat(vm, parts, n));
 }
 
-static Value _split(VM& vm, const String& str, Value indexes) {
-  if(indexes.isNil()) {
+static Value _split(VM& vm, const String& str, const Value* indexes, size_t n) {
+  if(n == 0) {
     return vm.makeCons(vm.makeString(str), vm.nil);
   } else {
-    Cons c = indexes.asCons(vm);
-    int l = c.first.asInteger(vm);
+    int l = indexes[0].asInteger(vm);
     if(l > (int)str.length) {
       VM_ERROR(vm, "string index out of bounds");
     }
     return vm.makeCons(
       vm.makeString(str.substr(0, l)),
-      _split(vm, str.substr(l, str.length - l), c.rest));
+      _split(vm, str.substr(l, str.length - l), indexes + 1, n - 1));
   }
 }
 
-Value builtin_split(VM& vm, Value args) {
-  Cons c = args.asCons(vm);
-  String str = c.first.asString(vm);
+Value builtin_split(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n >= 1);
+  String str = args[0].asString(vm);
   return _split(vm,
     str,
-    c.rest);
+    args + 1, n - 1);
 }
 
-Value builtin_symbol_name(VM& vm, Value args) {
-  return vm.makeString(singleValue(vm, args).asSymbol(vm));
+Value builtin_symbol_name(VM& vm, const Value* args, size_t n) {
+  return vm.makeString(singleValue(vm, args, n).asSymbol(vm));
 }
 
-Value builtin_make_symbol(VM& vm, Value args) {
-  String str = singleValue(vm, args).asString(vm);
+Value builtin_make_symbol(VM& vm, const Value* args, size_t n) {
+  String str = singleValue(vm, args, n).asString(vm);
   return vm.makeSymbol(str);
 }
 
-Value builtin_load_module(VM& vm, Value args) {
-  Value moduleName = singleValue(vm, args);
+Value builtin_load_module(VM& vm, const Value* args, size_t n) {
+  Value moduleName = singleValue(vm, args, n);
   VM_EXPECT(vm, moduleName.isSymbol());
   return map_lookup_or_else(vm, vm.loaded_modules, moduleName, [&vm](Value name) {
     return vm.loadModule(name);
   });
 }
 
-Value builtin_load_from_core(VM& vm, Value args) {
-  Value symName = singleValue(vm, args);
+Value builtin_load_from_core(VM& vm, const Value* args, size_t n) {
+  Value symName = singleValue(vm, args, n);
   VM_EXPECT(vm, symName.isSymbol());
   return map_lookup(vm, vm.core_imports, symName);
 }
\ No newline at end of file
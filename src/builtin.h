@@ -1,20 +1,85 @@
+#include <stddef.h>
 
 class Value;
 class VM;
 
-Value builtin_add(VM& vm, Value args);
-Value builtin_sub(VM& vm, Value args);
-Value builtin_mul(VM& vm, Value args);
-Value builtin_div(VM& vm, Value args);
-Value builtin_modulo(VM& vm, Value args);
-Value builtin_cons(VM& vm, Value args);
-Value builtin_first(VM& vm, Value args);
-Value builtin_rest(VM& vm, Value args);
-Value builtin_constructor(VM& vm, Value args);
-Value builtin_is_equal(VM& vm, Value args);
-Value builtin_concat(VM& vm, Value args);
-Value builtin_split(VM& vm, Value args);
-Value builtin_symbol_name(VM& vm, Value args);
-Value builtin_make_symbol(VM& vm, Value args);
-Value builtin_load_module(VM& vm, Value args);
-Value builtin_load_from_core(VM& vm, Value args);
\ No newline at end of file
+// Builtins get their arguments as a vector that only lives for the call.
+Value singleValue(VM& vm, const Value* args, size_t n);
+
+Value builtin_add(VM& vm, const Value* args, size_t n);
+Value builtin_sub(VM& vm, const Value* args, size_t n);
+Value builtin_mul(VM& vm, const Value* args, size_t n);
+Value builtin_div(VM& vm, const Value* args, size_t n);
+Value builtin_modulo(VM& vm, const Value* args, size_t n);
+Value builtin_cons(VM& vm, const Value* args, size_t n);
+Value builtin_first(VM& vm, const Value* args, size_t n);
+Value builtin_rest(VM& vm, const Value* args, size_t n);
+Value builtin_constructor(VM& vm, const Value* args, size_t n);
+Value builtin_is_equal(VM& vm, const Value* args, size_t n);
+Value builtin_concat(VM& vm, const Value* args, size_t n);
+Value builtin_split(VM& vm, const Value* args, size_t n);
+Value builtin_symbol_name(VM& vm, const Value* args, size_t n);
+Value builtin_make_symbol(VM& vm, const Value* args, size_t n);
+Value builtin_load_module(VM& vm, const Value* args, size_t n);
+Value builtin_load_from_core(VM& vm, const Value* args, size_t n);
+Value builtin_pmap(VM& vm, const Value* args, size_t n);
+Value builtin_pfilter(VM& vm, const Value* args, size_t n);
+Value builtin_preduce(VM& vm, const Value* args, size_t n);
+Value builtin_spawn(VM& vm, const Value* args, size_t n);
+Value builtin_send(VM& vm, const Value* args, size_t n);
+Value builtin_receive(VM& vm, const Value* args, size_t n);
+Value builtin_self(VM& vm, const Value* args, size_t n);
+Value builtin_freeze(VM& vm, const Value* args, size_t n);
+Value builtin_vector(VM& vm, const Value* args, size_t n);
+Value builtin_vector_ref(VM& vm, const Value* args, size_t n);
+Value builtin_vector_set(VM& vm, const Value* args, size_t n);
+Value builtin_vector_push(VM& vm, const Value* args, size_t n);
+Value builtin_vector_append(VM& vm, const Value* args, size_t n);
+Value builtin_vector_slice(VM& vm, const Value* args, size_t n);
+Value builtin_vector_length(VM& vm, const Value* args, size_t n);
+Value builtin_vector_to_list(VM& vm, const Value* args, size_t n);
+Value builtin_list_to_vector(VM& vm, const Value* args, size_t n);
+Value builtin_hash_map(VM& vm, const Value* args, size_t n);
+Value builtin_hash_get(VM& vm, const Value* args, size_t n);
+Value builtin_hash_has(VM& vm, const Value* args, size_t n);
+Value builtin_hash_assoc(VM& vm, const Value* args, size_t n);
+Value builtin_hash_dissoc(VM& vm, const Value* args, size_t n);
+Value builtin_hash_count(VM& vm, const Value* args, size_t n);
+Value builtin_hash_keys(VM& vm, const Value* args, size_t n);
+Value builtin_hash_to_list(VM& vm, const Value* args, size_t n);
+Value builtin_hash(VM& vm, const Value* args, size_t n);
+Value builtin_array(VM& vm, const Value* args, size_t n);
+Value builtin_list_to_array(VM& vm, const Value* args, size_t n);
+Value builtin_array_to_list(VM& vm, const Value* args, size_t n);
+Value builtin_array_range(VM& vm, const Value* args, size_t n);
+Value builtin_array_length(VM& vm, const Value* args, size_t n);
+Value builtin_array_ref(VM& vm, const Value* args, size_t n);
+Value builtin_array_add(VM& vm, const Value* args, size_t n);
+Value builtin_array_mul(VM& vm, const Value* args, size_t n);
+Value builtin_array_less(VM& vm, const Value* args, size_t n);
+Value builtin_array_sum(VM& vm, const Value* args, size_t n);
+Value builtin_array_dot(VM& vm, const Value* args, size_t n);
+Value builtin_array_min(VM& vm, const Value* args, size_t n);
+Value builtin_array_max(VM& vm, const Value* args, size_t n);
+Value builtin_string_length(VM& vm, const Value* args, size_t n);
+Value builtin_char_at(VM& vm, const Value* args, size_t n);
+Value builtin_char_code(VM& vm, const Value* args, size_t n);
+Value builtin_substring(VM& vm, const Value* args, size_t n);
+Value builtin_string_index_of(VM& vm, const Value* args, size_t n);
+Value builtin_string_span(VM& vm, const Value* args, size_t n);
+Value builtin_string_escape(VM& vm, const Value* args, size_t n);
+Value builtin_string_to_int(VM& vm, const Value* args, size_t n);
+Value builtin_int_to_string(VM& vm, const Value* args, size_t n);
+Value builtin_hash_cons_stats(VM& vm, const Value* args, size_t n);
+Value builtin_memoize(VM& vm, const Value* args, size_t n);
+Value builtin_memo_stats(VM& vm, const Value* args, size_t n);
+Value builtin_macroexpand(VM& vm, const Value* args, size_t n);
+Value builtin_open_input_file(VM& vm, const Value* args, size_t n);
+Value builtin_open_output_file(VM& vm, const Value* args, size_t n);
+Value builtin_standard_output_port(VM& vm, const Value* args, size_t n);
+Value builtin_read_line(VM& vm, const Value* args, size_t n);
+Value builtin_read_bytes(VM& vm, const Value* args, size_t n);
+Value builtin_write_string(VM& vm, const Value* args, size_t n);
+Value builtin_flush(VM& vm, const Value* args, size_t n);
+Value builtin_close_port(VM& vm, const Value* args, size_t n);
+Value builtin_heap_stats(VM& vm, const Value* args, size_t n);
\ No newline at end of file
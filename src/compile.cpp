@@ -0,0 +1,423 @@
+#include <stdio.h>
+
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "compile.h"
+#include "compiled.h"
+#include "vm.h"
+
+class CompiledBinding {
+public:
+  Value sym;
+  std::string name;
+};
+
+// The function being generated for one definition.  Variables it refers to
+// that belong to enclosing functions are captured, in the order they were
+// first referred to.
+class CompiledScope {
+public:
+  CompiledScope* parent;
+  const CompiledBinding* self;
+  std::vector<const CompiledBinding*> locals;
+  std::vector<const CompiledBinding*> captures;
+  size_t arity = 0;
+  bool rest = false;
+  bool loops = false;
+  bool usesConstants = false;
+
+  CompiledScope(CompiledScope* parent, const CompiledBinding* self): parent(parent), self(self) {}
+};
+
+static std::string str(size_t value) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%zu", value);
+  return buf;
+}
+
+static std::string mangle(Value sym) {
+  const String& name = sym.asSymbolUnsafe();
+  std::string out;
+  for(size_t i = 0; i < name.length; i++) {
+    char ch = name.text[i];
+    bool word = (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9');
+    out += word ? ch : '_';
+  }
+  return out;
+}
+
+static std::string c_string(const String& value) {
+  std::string out = "\"";
+  for(size_t i = 0; i < value.length; i++) {
+    unsigned char ch = value.text[i];
+    if(ch == '"' || ch == '\\' || ch == '?') {
+      out += '\\';
+      out += ch;
+    } else if(ch >= 0x20 && ch < 0x7f) {
+      out += ch;
+    } else {
+      char buf[8];
+      snprintf(buf, sizeof(buf), "\\%03o", ch);
+      out += buf;
+    }
+  }
+  return out + "\"";
+}
+
+class ModuleCompiler {
+public:
+  VM& vm;
+  std::deque<CompiledBinding> bindings;
+  std::vector<std::string> constants;
+  std::unordered_map<Object*, size_t> constantIndex;
+  std::unordered_map<int, size_t> integerIndex;
+  std::string prototypes;
+  std::string functions;
+  size_t functionCount = 0;
+  size_t temps = 0;
+
+  ModuleCompiler(VM& vm): vm(vm) {}
+
+  const CompiledBinding* bind(Value sym) {
+    VM_EXPECT(vm, sym.isSymbol());
+    bindings.push_back(CompiledBinding{sym, "v" + str(bindings.size()) + "_" + mangle(sym)});
+    return &bindings.back();
+  }
+
+  std::string temp() {
+    return "t" + str(temps++);
+  }
+
+  std::string constantExpr(Value value) {
+    switch(value->type()) {
+    case Object::Type::Nil:
+      return "vm.nil";
+    case Object::Type::Bool:
+      return value.asBoolUnsafe() ? "vm.true_" : "vm.false_";
+    case Object::Type::Integer: {
+      int i = value.asIntegerUnsafe();
+      return i == -2147483647 - 1 ? "vm.makeInteger(-2147483647 - 1)" : "vm.makeInteger(" + std::to_string(i) + ")";
+    }
+    case Object::Type::String: {
+      const String& s = value.asStringUnsafe();
+      return "vm.copyString(String(" + c_string(s) + ", " + str(s.length) + "))";
+    }
+    case Object::Type::Symbol: {
+      const String& s = value.asSymbolUnsafe();
+      return "vm.makeSymbol(String(" + c_string(s) + ", " + str(s.length) + "))";
+    }
+    case Object::Type::Builtin:
+      return "compiled_builtin(vm, " + c_string(String(builtin_name(value))) + ")";
+    case Object::Type::Cons: {
+      std::string items;
+      for(; value.isCons(); value = value->as_cons.rest) {
+        items += (items.empty() ? "" : ", ") + constantExpr(value->as_cons.first);
+      }
+      return "compiled_list(vm, {" + items + "}, " + constantExpr(value) + ")";
+    }
+    default:
+      VM_ERROR(vm, "can't compile a literal of this type");
+      return "";
+    }
+  }
+
+  // Quoted values are made once, when the module is loaded.
+  std::string constant(CompiledScope* s, Value value) {
+    if(value.isNil()) {
+      return "vm.nil";
+    } else if(value.isBool()) {
+      return value.asBoolUnsafe() ? "vm.true_" : "vm.false_";
+    }
+    size_t index;
+    auto found = value.isInteger()
+      ? integerIndex.find(value.asIntegerUnsafe())
+      : integerIndex.end();
+    auto foundObj = constantIndex.find(value.getObj());
+    if(found != integerIndex.end()) {
+      index = found->second;
+    } else if(foundObj != constantIndex.end()) {
+      index = foundObj->second;
+    } else {
+      index = constants.size();
+      constants.push_back(constantExpr(value));
+      if(value.isInteger()) {
+        integerIndex[value.asIntegerUnsafe()] = index;
+      } else {
+        constantIndex[value.getObj()] = index;
+      }
+    }
+    s->usesConstants = true;
+    return "k[" + str(index) + "]";
+  }
+
+  std::string lookup(CompiledScope* s, Value sym, const CompiledBinding** found) {
+    for(size_t i = s->locals.size(); i > 0; i--) {
+      if(s->locals[i - 1]->sym == sym) {
+        *found = s->locals[i - 1];
+        return s->locals[i - 1]->name;
+      }
+    }
+    for(size_t i = 0; i < s->captures.size(); i++) {
+      if(s->captures[i]->sym == sym) {
+        *found = s->captures[i];
+        return "c[" + str(i) + "]";
+      }
+    }
+    if(!s->parent || lookup(s->parent, sym, found).empty()) {
+      return "";
+    }
+    s->captures.push_back(*found);
+    return "c[" + str(s->captures.size() - 1) + "]";
+  }
+
+  std::string result(std::string& out, const std::string& ind, bool tail, const std::string& value) {
+    if(tail) {
+      out += ind + "return " + value + ";\n";
+      return "";
+    }
+    return value;
+  }
+
+  std::string variable(CompiledScope* s, Value sym, std::string& out, const std::string& ind, const CompiledBinding** found) {
+    std::string name = lookup(s, sym, found);
+    if(!name.empty()) {
+      return name;
+    }
+    *found = 0;
+    std::string t = temp();
+    out += ind + "Value " + t + " = compiled_unbound(vm, " + c_string(sym.asSymbolUnsafe()) + ");\n";
+    return t;
+  }
+
+  std::string expr(CompiledScope* s, Value o, std::string& out, const std::string& ind, bool tail) {
+    if(o.isSymbol()) {
+      const CompiledBinding* found;
+      return result(out, ind, tail, variable(s, o, out, ind, &found));
+    } else if(!o.isCons()) {
+      return result(out, ind, tail, constant(s, o));
+    }
+
+    Value head = o->as_cons.first;
+    Value items = o->as_cons.rest;
+    if(head == vm.syms.quote) {
+      Cons c = items.asCons(vm);
+      VM_EXPECT(vm, c.rest.isNil());
+      return result(out, ind, tail, constant(s, c.first));
+    } else if(head == vm.syms.import) {
+      Cons c = items.asCons(vm).rest.asCons(vm);
+      VM_EXPECT(vm, c.rest.isNil());
+      return result(out, ind, tail, "map_lookup(vm, vm.core_imports, " + constant(s, c.first) + ")");
+    } else if(head == vm.syms.if_) {
+      return compileIf(s, items, out, ind, tail);
+    } else if(head == vm.syms.letlambdas) {
+      return compileLetLambdas(s, items, out, ind, tail);
+    }
+    return compileCall(s, head, items, out, ind, tail);
+  }
+
+  std::string compileIf(CompiledScope* s, Value items, std::string& out, const std::string& ind, bool tail) {
+    Cons c = items.asCons(vm);
+    Value cond = c.first;
+    c = c.rest.asCons(vm);
+    Value then = c.first;
+    c = c.rest.asCons(vm);
+    Value otherwise = c.first;
+    VM_EXPECT(vm, c.rest.isNil());
+
+    std::string test = expr(s, cond, out, ind, false);
+    std::string t = tail ? "" : temp();
+    if(!tail) {
+      out += ind + "Value " + t + ";\n";
+    }
+    std::string inner = ind + "  ";
+    out += ind + "if(" + test + ".asBool(vm)) {\n";
+    std::string value = expr(s, then, out, inner, tail);
+    if(!tail) {
+      out += inner + t + " = " + value + ";\n";
+    }
+    out += ind + "} else {\n";
+    value = expr(s, otherwise, out, inner, tail);
+    if(!tail) {
+      out += inner + t + " = " + value + ";\n";
+    }
+    out += ind + "}\n";
+    return t;
+  }
+
+  std::string compileLetLambdas(CompiledScope* s, Value items, std::string& out, const std::string& ind, bool tail) {
+    Cons c = items.asCons(vm);
+    Value defs = c.first;
+    c = c.rest.asCons(vm);
+    VM_EXPECT(vm, c.rest.isNil());
+    Value inner = c.first;
+
+    size_t outer = s->locals.size();
+    std::vector<Value> params;
+    std::vector<Value> bodies;
+    for(Value d = defs; !d.isNil(); d = d.asCons(vm).rest) {
+      Cons def = d.asCons(vm).first.asCons(vm);
+      Cons nameAndParams = def.first.asCons(vm);
+      Cons body = def.rest.asCons(vm);
+      VM_EXPECT(vm, body.rest.isNil());
+      const CompiledBinding* b = bind(nameAndParams.first);
+      out += ind + "Value " + b->name + ";\n";
+      s->locals.push_back(b);
+      params.push_back(nameAndParams.rest);
+      bodies.push_back(body.first);
+    }
+
+    // Closures of the group are made before any of them captures anything,
+    // so that they can capture each other.
+    std::vector<std::unique_ptr<CompiledScope>> scopes;
+    for(size_t i = 0; i < bodies.size(); i++) {
+      const CompiledBinding* b = s->locals[outer + i];
+      scopes.emplace_back(new CompiledScope(s, b));
+      std::string func = compileFunction(*scopes.back(), params[i], bodies[i]);
+      out += ind + b->name + " = make_compiled(vm, " + c_string(b->sym.asSymbolUnsafe()) + ", " + func +
+        ", " + str(scopes.back()->captures.size()) + ", k);\n";
+      s->usesConstants = true;
+    }
+    for(size_t i = 0; i < bodies.size(); i++) {
+      const CompiledBinding* b = s->locals[outer + i];
+      const std::vector<const CompiledBinding*>& captures = scopes[i]->captures;
+      for(size_t j = 0; j < captures.size(); j++) {
+        const CompiledBinding* found;
+        std::string value = lookup(s, captures[j]->sym, &found);
+        out += ind + b->name + "->as_compiled.captured[" + str(j) + "] = " + value + ";\n";
+      }
+    }
+
+    std::string value = expr(s, inner, out, ind, tail);
+    s->locals.resize(outer);
+    return value;
+  }
+
+  std::string compileCall(CompiledScope* s, Value head, Value items, std::string& out, const std::string& ind, bool tail) {
+    std::string func;
+    const CompiledBinding* found = 0;
+    if(head.isSymbol()) {
+      func = variable(s, head, out, ind, &found);
+    } else {
+      func = expr(s, head, out, ind, false);
+    }
+
+    std::vector<std::string> args;
+    for(; items.isCons(); items = items->as_cons.rest) {
+      args.push_back(expr(s, items->as_cons.first, out, ind, false));
+    }
+    std::string list;
+    for(const std::string& arg : args) {
+      list += (list.empty() ? "" : ", ") + arg;
+    }
+
+    std::string data = "0";
+    std::string count = "0";
+    if(!items.isNil()) {
+      std::string spread = expr(s, items, out, ind, false);
+      std::string t = temp();
+      out += ind + "std::vector<Value> " + t + " = {" + list + "};\n";
+      out += ind + "compiled_spread(vm, " + t + ", " + spread + ");\n";
+      data = t + ".data()";
+      count = t + ".size()";
+    } else if(tail && found && found == s->self && !s->rest && args.size() == s->arity) {
+      for(size_t i = 0; i < args.size(); i++) {
+        out += ind + "loop[" + str(i) + "] = " + args[i] + ";\n";
+      }
+      out += ind + "args = " + (args.empty() ? "0" : "loop") + ";\n";
+      out += ind + "n = " + str(args.size()) + ";\n";
+      out += ind + "goto top;\n";
+      s->loops = true;
+      return "";
+    } else if(!args.empty()) {
+      std::string t = temp();
+      out += ind + "Value " + t + "[] = {" + list + "};\n";
+      data = t;
+      count = str(args.size());
+    }
+
+    // Builtins the optimizer put in the code are called directly.
+    std::string call = head.isBuiltin()
+      ? "builtin_func(" + func + ")(vm, " + data + ", " + count + ")"
+      : (tail ? "compiled_tail_call(vm, " : "apply(vm, ") + func + ", " + data + ", " + count + ")";
+    if(tail) {
+      out += ind + "return " + call + ";\n";
+      return "";
+    }
+    std::string t = temp();
+    out += ind + "Value " + t + " = " + call + ";\n";
+    return t;
+  }
+
+  std::string compileFunction(CompiledScope& s, Value params, Value body) {
+    std::string name = "f" + str(functionCount++) + (s.self ? "_" + mangle(s.self->sym) : "_module");
+    std::string bind_params;
+    std::string declare;
+    Value p = params;
+    for(; p.isCons(); p = p->as_cons.rest) {
+      const CompiledBinding* b = bind(p->as_cons.first);
+      s.locals.push_back(b);
+      declare += "  Value " + b->name + ";\n";
+      bind_params += "  " + b->name + " = args[" + str(s.arity++) + "];\n";
+    }
+    std::string check = "  VM_EXPECT(vm, n == " + str(s.arity) + ");\n";
+    if(!p.isNil()) {
+      const CompiledBinding* b = bind(p);
+      s.locals.push_back(b);
+      s.rest = true;
+      declare += "  Value " + b->name + ";\n";
+      bind_params += "  " + b->name + " = compiled_rest(vm, args, n, " + str(s.arity) + ");\n";
+      check = s.arity > 0 ? "  VM_EXPECT(vm, n >= " + str(s.arity) + ");\n" : "";
+    }
+
+    std::string code;
+    expr(&s, body, code, "  ", true);
+
+    std::string signature = "static Value " + name + "(VM& vm, Value self, const Value* args, size_t n)";
+    prototypes += signature + ";\n";
+    functions += "\n" + signature + " {\n";
+    if(!s.captures.empty()) {
+      functions += "  Value* c = self->as_compiled.captured;\n";
+    }
+    if(s.usesConstants) {
+      functions += "  const Value* k = self->as_compiled.constants;\n";
+    }
+    functions += declare;
+    if(s.loops) {
+      if(s.arity > 0) {
+        functions += "  Value loop[" + str(s.arity) + "];\n";
+      }
+      functions += "top:\n";
+    }
+    functions += check + bind_params + code + "}\n";
+    return name;
+  }
+
+  std::string module(Value program, const char* source) {
+    CompiledScope top(0, 0);
+    std::string entry = compileFunction(top, vm.nil, program);
+
+    std::string out;
+    out += "// Compiled by mylisp --compile-c from " + std::string(source) + "; build with\n";
+    out += "//   clang++ -std=c++11 -fPIC -shared -I<mylisp>/src -o <name>.so <this file>\n";
+    out += "// and load as native/<name>.\n\n";
+    out += "#include \"compiled.h\"\n\n";
+    out += prototypes;
+    out += functions;
+    out += "\nextern \"C\" void " COMPILED_MODULE_ENTRY "(VM& vm, Value* moduleFunc) {\n";
+    out += "  Value* k = (Value*)vm.alloc(sizeof(Value) * " + str(constants.size() + 1) + ");\n";
+    for(size_t i = 0; i < constants.size(); i++) {
+      out += "  k[" + str(i) + "] = " + constants[i] + ";\n";
+    }
+    out += "  *moduleFunc = apply(vm, make_compiled(vm, \"module\", " + entry + ", 0, k), 0, 0);\n";
+    out += "}\n";
+    return out;
+  }
+};
+
+std::string compile_module(VM& vm, Value program, const char* source) {
+  ModuleCompiler compiler(vm);
+  return compiler.module(program, source);
+}
@@ -0,0 +1,19 @@
+#ifndef MYLISP_COMPILE_H_
+#define MYLISP_COMPILE_H_
+
+#include <string>
+
+#include "value.h"
+
+// Translates a transformed module (the letlambdas IR) into C++ source for
+// a shared object that load-module can load as native/<path>; see
+// compiled.h for the runtime it links against.
+//
+// Every letlambdas definition becomes a function taking its closure, whose
+// free variables are copied into the closure when it is created.  Calls
+// of a function to itself in tail position become loops, other tail calls
+// are handed back to call_compiled, and builtins are called through apply
+// with the arguments on the C stack.  `source` is only used in comments.
+std::string compile_module(VM& vm, Value program, const char* source);
+
+#endif
@@ -0,0 +1,76 @@
+#include <string>
+
+#include "compiled.h"
+#include "serialize.h"
+
+// The capture count is kept in front of the captured values, so that
+// closures stay as small as every other object.
+Value make_compiled(VM& vm, const char* name, CompiledFunc func, size_t captures, const Value* constants) {
+  Value o = new(vm, Object::Type::Compiled) Object;
+  size_t* block = (size_t*)vm.alloc(sizeof(size_t) + sizeof(Value) * captures);
+  block[0] = captures;
+  Value* captured = (Value*)(block + 1);
+  for(size_t i = 0; i < captures; i++) {
+    captured[i] = vm.nil;
+  }
+  o->as_compiled.func = func;
+  o->as_compiled.name = name;
+  o->as_compiled.captured = captured;
+  o->as_compiled.constants = constants;
+  return o;
+}
+
+size_t compiled_captures(Value compiled) {
+  EXPECT(compiled.isCompiled());
+  return ((size_t*)compiled->as_compiled.captured)[-1];
+}
+
+Value call_compiled(VM& vm, Value func, const Value* args, size_t n) {
+  Value result = func->as_compiled.func(vm, func, args, n);
+  std::vector<Value> pending;
+  while(result.getObj() == 0) {
+    func = vm.tailFunc;
+    pending.swap(vm.tailArgs);
+    result = func->as_compiled.func(vm, func, pending.data(), pending.size());
+  }
+  return result;
+}
+
+Value compiled_tail_call(VM& vm, Value func, const Value* args, size_t n) {
+  if(!func.isCompiled()) {
+    return apply(vm, func, args, n);
+  }
+  vm.tailFunc = func;
+  vm.tailArgs.assign(args, args + n);
+  return Value();
+}
+
+Value compiled_rest(VM& vm, const Value* args, size_t n, size_t from) {
+  Value rest = vm.nil;
+  for(size_t i = n; i > from; i--) {
+    rest = vm.makeFreshCons(args[i - 1], rest);
+  }
+  return rest;
+}
+
+void compiled_spread(VM& vm, std::vector<Value>& args, Value rest) {
+  for(; !rest.isNil(); rest = rest.asCons(vm).rest) {
+    args.push_back(rest.asConsUnsafe().first);
+  }
+}
+
+Value compiled_list(VM& vm, std::initializer_list<Value> items, Value tail) {
+  for(const Value* item = items.end(); item != items.begin(); item--) {
+    tail = vm.makeCons(item[-1], tail);
+  }
+  return tail;
+}
+
+Value compiled_builtin(VM& vm, const char* name) {
+  return builtin_with_name(vm, String(name));
+}
+
+Value compiled_unbound(VM& vm, const char* name) {
+  std::string message = std::string("unbound variable ") + name;
+  VM_ERROR(vm, message.c_str());
+}
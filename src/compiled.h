@@ -0,0 +1,48 @@
+#ifndef MYLISP_COMPILED_H_
+#define MYLISP_COMPILED_H_
+
+#include <stddef.h>
+
+#include <initializer_list>
+#include <vector>
+
+#include "vm.h"
+#include "builtin.h"
+
+// The runtime of modules compiled by --compile-c.  Generated code only
+// calls these and the public VM API.
+
+Value make_compiled(VM& vm, const char* name, CompiledFunc func, size_t captures, const Value* constants);
+
+size_t compiled_captures(Value compiled);
+
+// Calls a compiled closure, then makes the tail calls it hands back until
+// one of them returns a value, so chains of tail calls between compiled
+// closures run in constant stack.
+Value call_compiled(VM& vm, Value func, const Value* args, size_t n);
+
+// What compiled code returns from a call in tail position.  Calls to other
+// compiled closures are left for call_compiled to make.
+Value compiled_tail_call(VM& vm, Value func, const Value* args, size_t n);
+
+// The list a rest parameter binds: the arguments from `from` on.
+Value compiled_rest(VM& vm, const Value* args, size_t n, size_t from);
+
+// Appends the items of the list that ends a dotted call.
+void compiled_spread(VM& vm, std::vector<Value>& args, Value rest);
+
+Value compiled_list(VM& vm, std::initializer_list<Value> items, Value tail);
+
+// A core builtin, by the name it was made with.
+Value compiled_builtin(VM& vm, const char* name);
+
+// Reports a variable that wasn't bound anywhere, like eval would.
+Value compiled_unbound(VM& vm, const char* name);
+
+// The entry point of a compiled module.  It evaluates the module's code,
+// giving the same module function that evaluating its source would.
+typedef void (*CompiledModuleEntry)(VM& vm, Value* moduleFunc);
+
+#define COMPILED_MODULE_ENTRY "mylisp_compiled_module"
+
+#endif
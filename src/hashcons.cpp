@@ -0,0 +1,75 @@
+#include "hashcons.h"
+#include "builtin.h"
+#include "vm.h"
+
+HashConsTable::HashConsTable(): slots(1024, 0) {}
+
+void HashConsTable::grow() {
+  std::vector<Object*> old(slots.size() * 2, 0);
+  old.swap(slots);
+  size_t mask = slots.size() - 1;
+  for(size_t i = 0; i < old.size(); i++) {
+    if(old[i]) {
+      size_t j = old[i]->as_cons.hash & mask;
+      while(slots[j]) {
+        j = (j + 1) & mask;
+      }
+      slots[j] = old[i];
+    }
+  }
+}
+
+Value HashConsTable::canonical(VM& vm, Value value) {
+  if(!value.isCons() || value->hashConsed()) {
+    return value;
+  }
+  std::vector<Object*> spine;
+  while(value.isCons() && !value->hashConsed()) {
+    spine.push_back(value.getObj());
+    value = value->as_cons.rest;
+  }
+  for(size_t i = spine.size(); i > 0; i--) {
+    value = insert(vm, canonical(vm, spine[i - 1]->as_cons.first), value);
+  }
+  return value;
+}
+
+Value HashConsTable::intern(VM& vm, Value first, Value rest) {
+  return insert(vm, canonical(vm, first), canonical(vm, rest));
+}
+
+Value HashConsTable::insert(VM& vm, Value first, Value rest) {
+  uint32_t hash = cons_hash(first, rest);
+  stats.lookups++;
+
+  size_t mask = slots.size() - 1;
+  size_t i = hash & mask;
+  while(Object* cell = slots[i]) {
+    Cons& c = cell->as_cons;
+    if(c.hash == hash && c.first == first && c.rest == rest) {
+      stats.hits++;
+      stats.bytesSaved += object_size(Object::Type::Cons);
+      return cell;
+    }
+    i = (i + 1) & mask;
+  }
+
+  Value cell = ::new(vm.allocHashConsedCell()) Object;
+  cell->as_cons.first = first;
+  cell->as_cons.rest = rest;
+  cell->as_cons.hash = hash;
+  slots[i] = cell.getObj();
+  if(++count * 2 > slots.size()) {
+    grow();
+  }
+  return cell;
+}
+
+Value builtin_hash_cons_stats(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 0);
+  HashConsStats stats = vm.hashConsStats();
+  return vm.makeList(
+    vm.makeCons(vm.makeSymbol("lookups"), vm.makeInteger(stats.lookups)),
+    vm.makeCons(vm.makeSymbol("hits"), vm.makeInteger(stats.hits)),
+    vm.makeCons(vm.makeSymbol("bytes-saved"), vm.makeInteger(stats.bytesSaved)));
+}
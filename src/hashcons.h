@@ -0,0 +1,41 @@
+#ifndef MYLISP_HASHCONS_H_
+#define MYLISP_HASHCONS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "value.h"
+
+class HashConsStats {
+public:
+  size_t lookups = 0;
+  size_t hits = 0;
+  size_t bytesSaved = 0;
+};
+
+// Interns cons cells by structure, so that equal lists built while
+// hash-consing is on share their cells.  The table belongs to the root VM
+// and is used under its shared lock.  Cells are never removed: like
+// everything else they live as long as the heaps they were allocated in.
+class HashConsTable {
+private:
+  std::vector<Object*> slots;
+  size_t count = 0;
+
+  void grow();
+  Value canonical(VM& vm, Value value);
+  Value insert(VM& vm, Value first, Value rest);
+
+public:
+  HashConsStats stats;
+
+  HashConsTable();
+
+  // Lists built before hash-consing was turned on are interned along with
+  // the new cell, so interned cells only ever point at interned cells.
+  Value intern(VM& vm, Value first, Value rest);
+};
+
+#endif
@@ -0,0 +1,322 @@
+#include <string.h>
+
+#include "hashmap.h"
+#include "builtin.h"
+#include "vm.h"
+
+static HashNode* make_node(VM& vm, uint32_t dataMap, uint32_t nodeMap, uint32_t collisions) {
+  size_t data = collisions ? collisions : __builtin_popcount(dataMap);
+  size_t nodes = __builtin_popcount(nodeMap);
+  HashNode* node = (HashNode*)vm.alloc(sizeof(HashNode) + sizeof(void*) * (2 * data + nodes));
+  node->dataMap = dataMap;
+  node->nodeMap = nodeMap;
+  node->collisions = collisions;
+  return node;
+}
+
+static inline uint32_t slot_bit(uint32_t hash, unsigned shift) {
+  return 1u << ((hash >> shift) & hashMask);
+}
+
+static inline size_t slot_index(uint32_t bitmap, uint32_t bit) {
+  return __builtin_popcount(bitmap & (bit - 1));
+}
+
+// Copies `node`, optionally dropping the pair at `removeData` and the child at
+// `removeNode`, and inserting a pair at `insertData` and a child at
+// `insertNode` (indices refer to the new node; -1 means none).
+static HashNode* rebuild(VM& vm, HashNode* node, uint32_t dataMap, uint32_t nodeMap, uint32_t collisions,
+    int removeData, int insertData, Value key, Value value,
+    int removeNode, int insertNode, HashNode* child) {
+  HashNode* copy = make_node(vm, dataMap, nodeMap, collisions);
+  void** to = copy->slots();
+
+  for(size_t i = 0, j = 0; j < copy->dataCount(); j++) {
+    if((int)j == insertData) {
+      to[2 * j] = key.getObj();
+      to[2 * j + 1] = value.getObj();
+      continue;
+    }
+    if((int)i == removeData) {
+      i++;
+    }
+    to[2 * j] = node->key(i).getObj();
+    to[2 * j + 1] = node->value(i).getObj();
+    i++;
+  }
+
+  to += 2 * copy->dataCount();
+  for(size_t i = 0, j = 0; j < copy->nodeCount(); j++) {
+    if((int)j == insertNode) {
+      to[j] = child;
+      continue;
+    }
+    if((int)i == removeNode) {
+      i++;
+    }
+    to[j] = node->child(i);
+    i++;
+  }
+  return copy;
+}
+
+static HashNode* make_pair_node(VM& vm, unsigned shift,
+    Value k1, Value v1, uint32_t h1, Value k2, Value v2, uint32_t h2) {
+  if(shift >= 32) {
+    HashNode* node = make_node(vm, 0, 0, 2);
+    node->slots()[0] = k1.getObj();
+    node->slots()[1] = v1.getObj();
+    node->slots()[2] = k2.getObj();
+    node->slots()[3] = v2.getObj();
+    return node;
+  }
+  uint32_t b1 = slot_bit(h1, shift);
+  uint32_t b2 = slot_bit(h2, shift);
+  if(b1 == b2) {
+    HashNode* node = make_node(vm, 0, b1, 0);
+    node->slots()[0] = make_pair_node(vm, shift + hashBits, k1, v1, h1, k2, v2, h2);
+    return node;
+  }
+  HashNode* node = make_node(vm, b1 | b2, 0, 0);
+  size_t first = b1 < b2 ? 0 : 1;
+  node->slots()[2 * first] = k1.getObj();
+  node->slots()[2 * first + 1] = v1.getObj();
+  node->slots()[2 * (1 - first)] = k2.getObj();
+  node->slots()[2 * (1 - first) + 1] = v2.getObj();
+  return node;
+}
+
+static HashNode* node_assoc(VM& vm, HashNode* node, unsigned shift, uint32_t hash, Value key, Value value, bool& added) {
+  if(!node) {
+    added = true;
+    return rebuild(vm, 0, slot_bit(hash, shift), 0, 0, -1, 0, key, value, -1, -1, 0);
+  }
+
+  if(node->collisions) {
+    for(size_t i = 0; i < node->collisions; i++) {
+      if(node->key(i) == key) {
+        return rebuild(vm, node, 0, 0, node->collisions, i, i, key, value, -1, -1, 0);
+      }
+    }
+    added = true;
+    return rebuild(vm, node, 0, 0, node->collisions + 1, -1, node->collisions, key, value, -1, -1, 0);
+  }
+
+  uint32_t bit = slot_bit(hash, shift);
+  if(node->dataMap & bit) {
+    size_t i = slot_index(node->dataMap, bit);
+    Value existing = node->key(i);
+    if(existing == key) {
+      if(node->value(i).getObj() == value.getObj()) {
+        return node;
+      }
+      return rebuild(vm, node, node->dataMap, node->nodeMap, 0, i, i, key, value, -1, -1, 0);
+    }
+    added = true;
+    HashNode* child = make_pair_node(vm, shift + hashBits,
+      existing, node->value(i), value_hash(existing), key, value, hash);
+    return rebuild(vm, node, node->dataMap & ~bit, node->nodeMap | bit, 0,
+      i, -1, key, value,
+      -1, slot_index(node->nodeMap | bit, bit), child);
+  } else if(node->nodeMap & bit) {
+    size_t i = slot_index(node->nodeMap, bit);
+    HashNode* child = node->child(i);
+    HashNode* updated = node_assoc(vm, child, shift + hashBits, hash, key, value, added);
+    if(updated == child) {
+      return node;
+    }
+    return rebuild(vm, node, node->dataMap, node->nodeMap, 0, -1, -1, key, value, i, i, updated);
+  } else {
+    added = true;
+    return rebuild(vm, node, node->dataMap | bit, node->nodeMap, 0,
+      -1, slot_index(node->dataMap | bit, bit), key, value,
+      -1, -1, 0);
+  }
+}
+
+static HashNode* node_dissoc(VM& vm, HashNode* node, unsigned shift, uint32_t hash, Value key, bool& removed) {
+  if(!node) {
+    return node;
+  }
+
+  if(node->collisions) {
+    for(size_t i = 0; i < node->collisions; i++) {
+      if(node->key(i) == key) {
+        removed = true;
+        return rebuild(vm, node, 0, 0, node->collisions - 1, i, -1, key, key, -1, -1, 0);
+      }
+    }
+    return node;
+  }
+
+  uint32_t bit = slot_bit(hash, shift);
+  if(node->dataMap & bit) {
+    size_t i = slot_index(node->dataMap, bit);
+    if(node->key(i) != key) {
+      return node;
+    }
+    removed = true;
+    return rebuild(vm, node, node->dataMap & ~bit, node->nodeMap, 0, i, -1, key, key, -1, -1, 0);
+  } else if(node->nodeMap & bit) {
+    size_t i = slot_index(node->nodeMap, bit);
+    HashNode* child = node->child(i);
+    HashNode* updated = node_dissoc(vm, child, shift + hashBits, hash, key, removed);
+    if(updated == child) {
+      return node;
+    }
+    if(updated->nodeCount() == 0 && updated->dataCount() == 0) {
+      return rebuild(vm, node, node->dataMap, node->nodeMap & ~bit, 0, -1, -1, key, key, i, -1, 0);
+    }
+    if(updated->nodeCount() == 0 && updated->dataCount() == 1) {
+      // Pull a lone pair back up so the trie stays as shallow as possible.
+      return rebuild(vm, node, node->dataMap | bit, node->nodeMap & ~bit, 0,
+        -1, slot_index(node->dataMap | bit, bit), updated->key(0), updated->value(0),
+        i, -1, 0);
+    }
+    return rebuild(vm, node, node->dataMap, node->nodeMap, 0, -1, -1, key, key, i, i, updated);
+  }
+  return node;
+}
+
+bool hashmap_find(Value map, Value key, Value& result) {
+  HashNode* node = map.asHashMapUnsafe().root;
+  uint32_t hash = value_hash(key);
+  unsigned shift = 0;
+  while(node) {
+    if(node->collisions) {
+      for(size_t i = 0; i < node->collisions; i++) {
+        if(node->key(i) == key) {
+          result = node->value(i);
+          return true;
+        }
+      }
+      return false;
+    }
+    uint32_t bit = slot_bit(hash, shift);
+    if(node->dataMap & bit) {
+      size_t i = slot_index(node->dataMap, bit);
+      if(node->key(i) == key) {
+        result = node->value(i);
+        return true;
+      }
+      return false;
+    } else if(node->nodeMap & bit) {
+      node = node->child(slot_index(node->nodeMap, bit));
+      shift += hashBits;
+    } else {
+      return false;
+    }
+  }
+  return false;
+}
+
+static Value make_hashmap_object(VM& vm, size_t count, HashNode* root) {
+  Value o = new(vm, Object::Type::HashMap) Object;
+  o.asHashMapUnsafe().count = count;
+  o.asHashMapUnsafe().root = root;
+  return o;
+}
+
+Value make_hashmap(VM& vm) {
+  return make_hashmap_object(vm, 0, 0);
+}
+
+Value hashmap_assoc(VM& vm, Value map, Value key, Value value) {
+  const HashMap& m = map.asHashMap(vm);
+  bool added = false;
+  HashNode* root = node_assoc(vm, m.root, 0, value_hash(key), key, value, added);
+  if(root == m.root) {
+    return map;
+  }
+  return make_hashmap_object(vm, m.count + (added ? 1 : 0), root);
+}
+
+Value hashmap_dissoc(VM& vm, Value map, Value key) {
+  const HashMap& m = map.asHashMap(vm);
+  bool removed = false;
+  HashNode* root = node_dissoc(vm, m.root, 0, value_hash(key), key, removed);
+  if(!removed) {
+    return map;
+  }
+  return make_hashmap_object(vm, m.count - 1, root);
+}
+
+Value hashmap_from_alist(VM& vm, Value alist) {
+  Value map = make_hashmap(vm);
+  while(!alist.isNil()) {
+    Cons c = alist.asCons(vm);
+    Cons pair = c.first.asCons(vm);
+    map = hashmap_assoc(vm, map, pair.first, pair.rest);
+    alist = c.rest;
+  }
+  return map;
+}
+
+Value hashmap_to_alist(VM& vm, Value map) {
+  map.asHashMap(vm);
+  Value alist = vm.nil;
+  hashmap_for_each(map, [&vm, &alist](Value key, Value value) {
+    alist = vm.makeCons(vm.makeCons(key, value), alist);
+  });
+  return alist;
+}
+
+Value builtin_hash_map(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n % 2 == 0);
+  Value map = make_hashmap(vm);
+  for(size_t i = 0; i < n; i += 2) {
+    map = hashmap_assoc(vm, map, args[i], args[i + 1]);
+  }
+  return map;
+}
+
+// (hash-get map key [default]) returns the default, or () if none was
+// given, when the key is missing.
+Value builtin_hash_get(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2 || n == 3);
+  args[0].asHashMap(vm);
+  Value result;
+  if(hashmap_find(args[0], args[1], result)) {
+    return result;
+  }
+  return n == 3 ? args[2] : vm.nil;
+}
+
+Value builtin_hash_has(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2);
+  args[0].asHashMap(vm);
+  Value result;
+  return vm.makeBool(hashmap_find(args[0], args[1], result));
+}
+
+Value builtin_hash_assoc(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 3);
+  return hashmap_assoc(vm, args[0], args[1], args[2]);
+}
+
+Value builtin_hash_dissoc(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2);
+  return hashmap_dissoc(vm, args[0], args[1]);
+}
+
+Value builtin_hash_count(VM& vm, const Value* args, size_t n) {
+  return vm.makeInteger(singleValue(vm, args, n).asHashMap(vm).count);
+}
+
+Value builtin_hash_keys(VM& vm, const Value* args, size_t n) {
+  Value map = singleValue(vm, args, n);
+  map.asHashMap(vm);
+  Value keys = vm.nil;
+  hashmap_for_each(map, [&vm, &keys](Value key, Value value) {
+    keys = vm.makeCons(key, keys);
+  });
+  return keys;
+}
+
+Value builtin_hash_to_list(VM& vm, const Value* args, size_t n) {
+  return hashmap_to_alist(vm, singleValue(vm, args, n));
+}
+
+Value builtin_hash(VM& vm, const Value* args, size_t n) {
+  return vm.makeInteger((int)value_hash(singleValue(vm, args, n)));
+}
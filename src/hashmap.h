@@ -0,0 +1,63 @@
+#ifndef MYLISP_HASHMAP_H_
+#define MYLISP_HASHMAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "value.h"
+
+// Hash array mapped tries.  Each node keeps two bitmaps over the 32 slots
+// addressed by the next five bits of the hash: one for inline key/value
+// pairs and one for child nodes.  The pairs are stored first, then the
+// children.  Keys whose hashes collide on all 32 bits end up in a collision
+// node, which is a plain list of pairs.
+const unsigned hashBits = 5;
+const uint32_t hashMask = (1 << hashBits) - 1;
+
+class HashNode {
+public:
+  uint32_t dataMap;
+  uint32_t nodeMap;
+  uint32_t collisions;
+
+  inline void** slots() { return (void**)(this + 1); }
+
+  inline size_t dataCount() {
+    return collisions ? collisions : __builtin_popcount(dataMap);
+  }
+  inline size_t nodeCount() { return __builtin_popcount(nodeMap); }
+
+  inline Value key(size_t i) { return (Object*)slots()[2 * i]; }
+  inline Value value(size_t i) { return (Object*)slots()[2 * i + 1]; }
+  inline HashNode* child(size_t i) { return (HashNode*)slots()[2 * dataCount() + i]; }
+};
+
+template<class Func>
+void hashnode_for_each(HashNode* node, Func& func) {
+  if(!node) {
+    return;
+  }
+  for(size_t i = 0; i < node->dataCount(); i++) {
+    func(node->key(i), node->value(i));
+  }
+  for(size_t i = 0; i < node->nodeCount(); i++) {
+    hashnode_for_each(node->child(i), func);
+  }
+}
+
+template<class Func>
+void hashmap_for_each(Value map, Func func) {
+  hashnode_for_each(map.asHashMapUnsafe().root, func);
+}
+
+Value make_hashmap(VM& vm);
+
+Value hashmap_assoc(VM& vm, Value map, Value key, Value value);
+
+Value hashmap_dissoc(VM& vm, Value map, Value key);
+
+Value hashmap_from_alist(VM& vm, Value alist);
+
+Value hashmap_to_alist(VM& vm, Value map);
+
+#endif
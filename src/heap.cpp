@@ -0,0 +1,114 @@
+#include <limits.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+
+#include <algorithm>
+
+#include "heap.h"
+#include "builtin.h"
+#include "vm.h"
+
+// Maps one huge page more than needed and trims the ends, so the block
+// starts on a huge page boundary.
+static uint8_t* map_block_data(size_t size) {
+  size_t length = size + hugeBlockSize;
+  void* p = mmap(0, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if(p == MAP_FAILED) {
+    return 0;
+  }
+  uintptr_t start = (uintptr_t)p;
+  uintptr_t aligned = (start + hugeBlockSize - 1) & ~(uintptr_t)(hugeBlockSize - 1);
+  if(aligned > start) {
+    munmap(p, aligned - start);
+  }
+  size_t tail = start + length - (aligned + size);
+  if(tail > 0) {
+    munmap((void*)(aligned + size), tail);
+  }
+#ifdef MADV_HUGEPAGE
+  madvise((void*)aligned, size, MADV_HUGEPAGE);
+#endif
+  return (uint8_t*)aligned;
+}
+
+heap_block_t* make_heap_block(size_t size, heap_block_t* next) {
+  bool huge = size >= hugeBlockSize;
+  size_t granule = huge ? hugeBlockSize : pageSize;
+  size = (size + granule - 1) & ~(granule - 1);
+
+  heap_block_t* h = (heap_block_t*) malloc(sizeof(heap_block_t));
+  if(!h) {
+    return 0;
+  }
+  void* data = 0;
+  if(huge) {
+    data = map_block_data(size);
+  } else if(posix_memalign(&data, pageSize, size) != 0) {
+    data = 0;
+  }
+  if(!data) {
+    free(h);
+    return 0;
+  }
+  h->next = next;
+  h->capacity = size;
+  h->used = 0;
+  h->data = (uint8_t*)data;
+  h->mapped = huge ? size : 0;
+  return h;
+}
+
+void free_heap_blocks(heap_block_t* h) {
+  while(h) {
+    heap_block_t* next = h->next;
+    if(h->mapped) {
+      munmap(h->data, h->mapped);
+    } else {
+      free(h->data);
+    }
+    free(h);
+    h = next;
+  }
+}
+
+size_t heap_block_footprint(const heap_block_t* h) {
+  return h->capacity + sizeof(heap_block_t);
+}
+
+void PagedHeap::clear() {
+  blocks = 0;
+  for(size_t i = 0; i < pageKinds; i++) {
+    next[i] = end[i] = 0;
+  }
+}
+
+uint8_t* init_page(uint8_t* page, Object::Type type, bool hashConsed) {
+  PageHeader* header = (PageHeader*)page;
+  header->type = type;
+  header->hashConsed = hashConsed;
+  return page + pageHeaderSize;
+}
+
+void HeapStats::add(const heap_block_t* chain) {
+  for(const heap_block_t* h = chain; h; h = h->next) {
+    used += h->used;
+    reserved += heap_block_footprint(h);
+    blocks++;
+  }
+}
+
+// Integers are 32 bits wide, so sizes are given in KiB, rounded up, to
+// stay in range past 2 GB.
+static Value kib(VM& vm, size_t bytes) {
+  return vm.makeInteger((int)std::min((bytes + 1023) / 1024, (size_t)INT_MAX));
+}
+
+Value builtin_heap_stats(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 0);
+  HeapStats stats = vm.heapStats();
+  return vm.makeList(
+    vm.makeCons(vm.makeSymbol("used-kib"), kib(vm, stats.used)),
+    vm.makeCons(vm.makeSymbol("reserved-kib"), kib(vm, stats.reserved)),
+    vm.makeCons(vm.makeSymbol("blocks"), vm.makeInteger((int)std::min(stats.blocks, (size_t)INT_MAX))),
+    vm.makeCons(vm.makeSymbol("family-reserved-kib"), kib(vm, vm.familyReserved())));
+}
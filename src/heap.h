@@ -0,0 +1,77 @@
+#ifndef MYLISP_HEAP_H_
+#define MYLISP_HEAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "value.h"
+
+// A block of memory handed out front to back, in pages.  The header is
+// allocated apart from `data`, which is aligned to pageSize.  Blocks are
+// chained through `next` and freed all at once.
+struct heap_block_t {
+  heap_block_t* next;
+  size_t capacity;
+  size_t used;
+  uint8_t* data;
+
+  // The length of the mapping for blocks that came from mmap, 0 for blocks
+  // from malloc.
+  size_t mapped;
+};
+
+// Blocks at least this big are mapped directly, aligned so the kernel can
+// back them with transparent huge pages.
+const size_t hugeBlockSize = 2 * 1024 * 1024;
+
+// A heap's blocks double in size as it grows, up to this.
+const size_t maxHeapBlockSize = 8 * 1024 * 1024;
+
+// Returns 0 if the memory couldn't be had.  The capacity is `size` rounded
+// up to whole pages.
+heap_block_t* make_heap_block(size_t size, heap_block_t* next);
+
+// Frees `h` and every block after it.
+void free_heap_blocks(heap_block_t* h);
+
+// What a block costs, header included.
+size_t heap_block_footprint(const heap_block_t* h);
+
+// Pages are filled separately by kind: one kind per object type, one for
+// hash-consed cells and one for memory that isn't an object.
+const size_t objectKinds = (size_t)Object::Type::Port + 1;
+const size_t hashConsedKind = objectKinds;
+const size_t rawKind = objectKinds + 1;
+const size_t pageKinds = objectKinds + 2;
+
+// Blocks and the page of each kind being filled.
+class PagedHeap {
+public:
+  heap_block_t* blocks = 0;
+
+  // The size of the next block.
+  size_t blockSize;
+
+  // The room left in the current page of each kind.
+  uint8_t* next[pageKinds] = {};
+  uint8_t* end[pageKinds] = {};
+
+  explicit PagedHeap(size_t blockSize): blockSize(blockSize) {}
+
+  // Forgets the current pages, once the blocks have been handed on.
+  void clear();
+};
+
+// Starts a page of `type` at `page` and returns where its objects go.
+uint8_t* init_page(uint8_t* page, Object::Type type, bool hashConsed = false);
+
+class HeapStats {
+public:
+  size_t used = 0;
+  size_t reserved = 0;
+  size_t blocks = 0;
+
+  void add(const heap_block_t* chain);
+};
+
+#endif
@@ -0,0 +1,562 @@
+#include <string.h>
+
+#if defined(__x86_64__) && defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define JIT_SUPPORTED
+#endif
+
+#include <memory>
+#include <vector>
+
+#include "jit.h"
+#include "builtin.h"
+#include "vm.h"
+
+Jit::~Jit() {
+#ifdef JIT_SUPPORTED
+  for(const Pages& p : pages) {
+    munmap(p.data, p.size);
+  }
+#endif
+}
+
+// Code is written while its pages are writable and only then made
+// executable, so no page is ever both.
+void* Jit::allocCode(const void* code, size_t size) {
+#ifdef JIT_SUPPORTED
+  size_t pageSize = sysconf(_SC_PAGESIZE);
+  size_t length = (size + pageSize - 1) / pageSize * pageSize;
+  void* data = mmap(0, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if(data == MAP_FAILED) {
+    return 0;
+  }
+  memcpy(data, code, size);
+  if(mprotect(data, length, PROT_READ | PROT_EXEC) != 0) {
+    munmap(data, length);
+    return 0;
+  }
+  pages.push_back(Pages{data, length});
+  return data;
+#else
+  return 0;
+#endif
+}
+
+JitStats jit_stats(VM& vm) {
+  return vm.jit ? vm.jit->stats : JitStats();
+}
+
+// The body of a compilable lambda, with its variables resolved.
+class JitNode {
+public:
+  enum class Kind {
+    Integer,
+    Bool,
+    Param,
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Modulo,
+    Equal,
+    If,
+    SelfCall
+  };
+
+  Kind kind;
+  int value = 0;
+  std::vector<std::unique_ptr<JitNode>> items;
+
+  JitNode(Kind kind): kind(kind) {}
+};
+
+enum class JitType {
+  Int,
+  Bool,
+  Invalid
+};
+
+static const size_t maxNodes = 1000;
+
+class JitParser {
+public:
+  VM& vm;
+  Value self;
+  Lambda lambda;
+  std::vector<Value> params;
+  size_t nodes = 0;
+
+  JitParser(VM& vm, Value self): vm(vm), self(self), lambda(self.asLambdaUnsafe()) {}
+
+  bool parseParams() {
+    Value p = lambda.params;
+    for(; p.isCons(); p = p->as_cons.rest) {
+      if(!p->as_cons.first.isSymbol()) {
+        return false;
+      }
+      params.push_back(p->as_cons.first);
+    }
+    return p.isNil();
+  }
+
+  int paramIndex(Value sym) {
+    for(size_t i = params.size(); i > 0; i--) {
+      if(params[i - 1] == sym) {
+        return (int)(i - 1);
+      }
+    }
+    return -1;
+  }
+
+  // What a variable that isn't a parameter refers to.  The environment of
+  // a closure never changes once it has been called, so it can be looked
+  // up once, here.
+  Value resolve(Value o) {
+    if(o.isSymbol()) {
+      return map_lookup_or_else(vm, lambda.env, o, [](Value) { return Value(); });
+    } else if(o.isCons() && o->as_cons.first == vm.syms.import) {
+      Value rest = o->as_cons.rest;
+      if(!rest.isCons() || !rest->as_cons.rest.isCons()) {
+        return Value();
+      }
+      return map_lookup_or_else(vm, vm.core_imports, rest->as_cons.rest->as_cons.first, [](Value) { return Value(); });
+    }
+    return o;
+  }
+
+  std::unique_ptr<JitNode> constant(Value value) {
+    if(value.getObj() == 0) {
+      return 0;
+    } else if(value.isInteger()) {
+      std::unique_ptr<JitNode> node(new JitNode(JitNode::Kind::Integer));
+      node->value = value.asIntegerUnsafe();
+      return node;
+    } else if(value.isBool()) {
+      std::unique_ptr<JitNode> node(new JitNode(JitNode::Kind::Bool));
+      node->value = value.asBoolUnsafe();
+      return node;
+    }
+    return 0;
+  }
+
+  std::unique_ptr<JitNode> parse(Value o) {
+    if(++nodes > maxNodes) {
+      return 0;
+    }
+    if(o.isSymbol()) {
+      int index = paramIndex(o);
+      if(index >= 0) {
+        std::unique_ptr<JitNode> node(new JitNode(JitNode::Kind::Param));
+        node->value = index;
+        return node;
+      }
+      return constant(resolve(o));
+    } else if(!o.isCons()) {
+      return constant(o);
+    }
+
+    Value head = o->as_cons.first;
+    if(head == vm.syms.quote) {
+      Value rest = o->as_cons.rest;
+      return rest.isCons() ? constant(rest->as_cons.first) : 0;
+    } else if(head == vm.syms.if_) {
+      return parseItems(JitNode::Kind::If, o->as_cons.rest);
+    } else if(head == vm.syms.letlambdas || head == vm.syms.import) {
+      return 0;
+    }
+
+    if(head.isSymbol() && paramIndex(head) >= 0) {
+      return 0;
+    }
+    Value f = resolve(head);
+    if(f.getObj() == 0) {
+      return 0;
+    } else if(f == self) {
+      return parseItems(JitNode::Kind::SelfCall, o->as_cons.rest);
+    } else if(!f.isBuiltin()) {
+      return 0;
+    }
+    BuiltinFunc func = builtin_func(f);
+    if(func == builtin_add) {
+      return parseItems(JitNode::Kind::Add, o->as_cons.rest);
+    } else if(func == builtin_sub) {
+      return parseItems(JitNode::Kind::Sub, o->as_cons.rest);
+    } else if(func == builtin_mul) {
+      return parseItems(JitNode::Kind::Mul, o->as_cons.rest);
+    } else if(func == builtin_div) {
+      return parseItems(JitNode::Kind::Div, o->as_cons.rest);
+    } else if(func == builtin_modulo) {
+      return parseItems(JitNode::Kind::Modulo, o->as_cons.rest);
+    } else if(func == builtin_is_equal) {
+      return parseItems(JitNode::Kind::Equal, o->as_cons.rest);
+    }
+    return 0;
+  }
+
+  std::unique_ptr<JitNode> parseItems(JitNode::Kind kind, Value items) {
+    std::unique_ptr<JitNode> node(new JitNode(kind));
+    for(; items.isCons(); items = items->as_cons.rest) {
+      std::unique_ptr<JitNode> item = parse(items->as_cons.first);
+      if(!item) {
+        return 0;
+      }
+      node->items.push_back(std::move(item));
+    }
+    if(!items.isNil()) {
+      return 0;
+    }
+    return node;
+  }
+};
+
+// Types every node, given what calls to the lambda itself return.  Calls
+// the interpreter would reject, like (modulo 1) or (if 1 2 3), are
+// rejected here too, so that it gets to report them.
+static JitType check(const JitNode& node, size_t arity, JitType selfType) {
+  size_t n = node.items.size();
+  switch(node.kind) {
+  case JitNode::Kind::Integer:
+  case JitNode::Kind::Param:
+    return JitType::Int;
+  case JitNode::Kind::Bool:
+    return JitType::Bool;
+  case JitNode::Kind::Div:
+  case JitNode::Kind::Modulo:
+    if(n == 0 || (node.kind == JitNode::Kind::Modulo && n != 2)) {
+      return JitType::Invalid;
+    }
+    // fallthrough
+  case JitNode::Kind::Add:
+  case JitNode::Kind::Sub:
+  case JitNode::Kind::Mul:
+    for(const auto& item : node.items) {
+      if(check(*item, arity, selfType) != JitType::Int) {
+        return JitType::Invalid;
+      }
+    }
+    return JitType::Int;
+  case JitNode::Kind::Equal: {
+    if(n != 2) {
+      return JitType::Invalid;
+    }
+    JitType a = check(*node.items[0], arity, selfType);
+    JitType b = check(*node.items[1], arity, selfType);
+    return a == b && a != JitType::Invalid ? JitType::Bool : JitType::Invalid;
+  }
+  case JitNode::Kind::If: {
+    if(n != 3 || check(*node.items[0], arity, selfType) != JitType::Bool) {
+      return JitType::Invalid;
+    }
+    JitType a = check(*node.items[1], arity, selfType);
+    JitType b = check(*node.items[2], arity, selfType);
+    return a == b ? a : JitType::Invalid;
+  }
+  case JitNode::Kind::SelfCall:
+    if(n != arity) {
+      return JitType::Invalid;
+    }
+    for(const auto& item : node.items) {
+      if(check(*item, arity, selfType) != JitType::Int) {
+        return JitType::Invalid;
+      }
+    }
+    return selfType;
+  }
+  return JitType::Invalid;
+}
+
+#ifdef JIT_SUPPORTED
+
+// Just the x86-64 instructions the code generator uses.  Values live in
+// eax, with rcx and edx as scratch; operands wait on the machine stack.
+// rbx points at the arguments, 8 bytes apart.
+class JitAssembler {
+public:
+  std::vector<uint8_t> code;
+
+  size_t here() { return code.size(); }
+
+  void bytes(std::initializer_list<uint8_t> list) {
+    code.insert(code.end(), list);
+  }
+
+  void u32(uint32_t value) {
+    for(int i = 0; i < 4; i++) {
+      code.push_back((uint8_t)(value >> (i * 8)));
+    }
+  }
+
+  void u64(uint64_t value) {
+    u32((uint32_t)value);
+    u32((uint32_t)(value >> 32));
+  }
+
+  void prologue() {
+    bytes({0x55});                      // push rbp
+    bytes({0x48, 0x89, 0xe5});          // mov rbp, rsp
+    bytes({0x53});                      // push rbx
+    bytes({0x48, 0x89, 0xfb});          // mov rbx, rdi
+  }
+
+  void epilogue() {
+    bytes({0x48, 0x8b, 0x5d, 0xf8});    // mov rbx, [rbp - 8]
+    bytes({0x48, 0x89, 0xec});          // mov rsp, rbp
+    bytes({0x5d});                      // pop rbp
+    bytes({0xc3});                      // ret
+  }
+
+  void movEaxImm(int32_t value) { bytes({0xb8}); u32((uint32_t)value); }
+  void movRaxImm(uint64_t value) { bytes({0x48, 0xb8}); u64(value); }
+  void loadArg(int index) { bytes({0x8b, 0x83}); u32(index * 8); }       // mov eax, [rbx + 8i]
+  void storeArg(int index) { bytes({0x48, 0x89, 0x83}); u32(index * 8); } // mov [rbx + 8i], rax
+  void pushRax() { bytes({0x50}); }
+  void popRax() { bytes({0x58}); }
+  void movEcxEax() { bytes({0x89, 0xc1}); }
+  void movEaxEax() { bytes({0x89, 0xc0}); }
+  void movEaxEdx() { bytes({0x89, 0xd0}); }
+  void addEaxEcx() { bytes({0x01, 0xc8}); }
+  void subEaxEcx() { bytes({0x29, 0xc8}); }
+  void imulEaxEcx() { bytes({0x0f, 0xaf, 0xc1}); }
+  void negEax() { bytes({0xf7, 0xd8}); }
+  void idivEcx() { bytes({0x99, 0xf7, 0xf9}); }          // cdq; idiv ecx
+  void testEaxEax() { bytes({0x85, 0xc0}); }
+  void testEcxEcx() { bytes({0x85, 0xc9}); }
+  void cmpEcxMinusOne() { bytes({0x83, 0xf9, 0xff}); }
+  void cmpEaxEcx() { bytes({0x39, 0xc8}); }
+  void seteEax() { bytes({0x0f, 0x94, 0xc0, 0x0f, 0xb6, 0xc0}); } // sete al; movzx eax, al
+  void movRdiRsp() { bytes({0x48, 0x89, 0xe7}); }
+  void addRsp(uint32_t value) { bytes({0x48, 0x81, 0xc4}); u32(value); }
+  void testRaxHigh() { bytes({0x48, 0x89, 0xc1, 0x48, 0xc1, 0xe9, 0x20}); } // mov rcx, rax; shr rcx, 32
+
+  // Jumps and calls take a rel32 that is patched once the target is known.
+  size_t jz() { bytes({0x0f, 0x84}); u32(0); return here(); }
+  size_t jnz() { bytes({0x0f, 0x85}); u32(0); return here(); }
+  size_t jmp() { bytes({0xe9}); u32(0); return here(); }
+  size_t call() { bytes({0xe8}); u32(0); return here(); }
+
+  void patch(size_t end, size_t target) {
+    uint32_t rel = (uint32_t)((int64_t)target - (int64_t)end);
+    memcpy(&code[end - 4], &rel, 4);
+  }
+};
+
+class JitCodeGen {
+public:
+  JitAssembler a;
+  size_t arity;
+  size_t bodyStart = 0;
+  std::vector<size_t> toEpilogue;
+  std::vector<size_t> toBailout;
+
+  JitCodeGen(size_t arity): arity(arity) {}
+
+  void operands(const JitNode& node) {
+    emit(*node.items[0], false);
+    for(size_t i = 1; i < node.items.size(); i++) {
+      a.pushRax();
+      emit(*node.items[i], false);
+      a.movEcxEax();
+      a.popRax();
+      switch(node.kind) {
+      case JitNode::Kind::Add: a.addEaxEcx(); break;
+      case JitNode::Kind::Sub: a.subEaxEcx(); break;
+      case JitNode::Kind::Mul: a.imulEaxEcx(); break;
+      case JitNode::Kind::Div:
+      case JitNode::Kind::Modulo:
+        // idiv traps on a zero divisor and on INT_MIN / -1, so those are
+        // left to the builtins: one raises an error, the other wraps.
+        a.testEcxEcx();
+        toBailout.push_back(a.jz());
+        a.cmpEcxMinusOne();
+        toBailout.push_back(a.jz());
+        a.idivEcx();
+        if(node.kind == JitNode::Kind::Modulo) {
+          a.movEaxEdx();
+        }
+        break;
+      default:
+        break;
+      }
+    }
+  }
+
+  void emit(const JitNode& node, bool tail) {
+    switch(node.kind) {
+    case JitNode::Kind::Integer:
+    case JitNode::Kind::Bool:
+      a.movEaxImm(node.value);
+      break;
+    case JitNode::Kind::Param:
+      a.loadArg(node.value);
+      break;
+    case JitNode::Kind::Add:
+    case JitNode::Kind::Mul:
+      if(node.items.empty()) {
+        a.movEaxImm(node.kind == JitNode::Kind::Add ? 0 : 1);
+      } else {
+        operands(node);
+      }
+      break;
+    case JitNode::Kind::Sub:
+      if(node.items.empty()) {
+        a.movEaxImm(0);
+      } else if(node.items.size() == 1) {
+        emit(*node.items[0], false);
+        a.negEax();
+      } else {
+        operands(node);
+      }
+      break;
+    case JitNode::Kind::Div:
+    case JitNode::Kind::Modulo:
+      operands(node);
+      break;
+    case JitNode::Kind::Equal:
+      emit(*node.items[0], false);
+      a.pushRax();
+      emit(*node.items[1], false);
+      a.movEcxEax();
+      a.popRax();
+      a.cmpEaxEcx();
+      a.seteEax();
+      break;
+    case JitNode::Kind::If: {
+      emit(*node.items[0], false);
+      a.testEaxEax();
+      size_t toElse = a.jz();
+      emit(*node.items[1], tail);
+      size_t toEnd = a.jmp();
+      a.patch(toElse, a.here());
+      emit(*node.items[2], tail);
+      a.patch(toEnd, a.here());
+    } break;
+    case JitNode::Kind::SelfCall:
+      for(size_t i = arity; i > 0; i--) {
+        emit(*node.items[i - 1], false);
+        a.pushRax();
+      }
+      if(tail) {
+        // A tail call reuses the arguments of this one, so loops written
+        // as tail calls run in constant stack like they do in eval.
+        for(size_t i = 0; i < arity; i++) {
+          a.popRax();
+          a.storeArg((int)i);
+        }
+        a.patch(a.jmp(), bodyStart);
+      } else {
+        a.movRdiRsp();
+        a.patch(a.call(), 0);
+        a.addRsp((uint32_t)(arity * 8));
+        a.testRaxHigh();
+        toEpilogue.push_back(a.jnz());
+      }
+      break;
+    }
+  }
+
+  const std::vector<uint8_t>& generate(const JitNode& body) {
+    a.prologue();
+    bodyStart = a.here();
+    emit(body, true);
+    a.movEaxEax();
+    size_t epilogue = a.here();
+    a.epilogue();
+    size_t bailout = a.here();
+    a.movRaxImm(jitBailout);
+    a.patch(a.jmp(), epilogue);
+    for(size_t from : toEpilogue) {
+      a.patch(from, epilogue);
+    }
+    for(size_t from : toBailout) {
+      a.patch(from, bailout);
+    }
+    return a.code;
+  }
+};
+
+#endif
+
+static bool compile(VM& vm, Value lambda, Jit::Entry& entry) {
+#ifdef JIT_SUPPORTED
+  JitParser parser(vm, lambda);
+  if(!parser.parseParams()) {
+    return false;
+  }
+  std::unique_ptr<JitNode> body = parser.parse(parser.lambda.body);
+  if(!body) {
+    return false;
+  }
+  size_t arity = parser.params.size();
+  JitType type = check(*body, arity, JitType::Int);
+  if(type != JitType::Int) {
+    type = check(*body, arity, JitType::Bool) == JitType::Bool ? JitType::Bool : JitType::Invalid;
+  }
+  if(type == JitType::Invalid) {
+    return false;
+  }
+
+  JitCodeGen gen(arity);
+  const std::vector<uint8_t>& code = gen.generate(*body);
+  void* native = vm.jit->allocCode(code.data(), code.size());
+  if(!native) {
+    return false;
+  }
+  entry.code = (JitCode)native;
+  entry.arity = arity;
+  entry.returnsBool = type == JitType::Bool;
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool jit_call(VM& vm, Value lambda, const Value* args, size_t n, Value& result) {
+  if(!vm.jit) {
+    vm.jit = new Jit();
+  }
+  Jit& jit = *vm.jit;
+  Jit::Entry& entry = jit.entries[lambda.getObj()];
+  if(!entry.code) {
+    if(entry.tried) {
+      return false;
+    }
+    unsigned threshold = vm.jitMode == JitMode::Always ? 1 : jitThreshold;
+    if(++entry.calls < threshold) {
+      return false;
+    }
+    entry.tried = true;
+    if(!compile(vm, lambda, entry)) {
+      jit.stats.rejected++;
+      return false;
+    }
+    jit.stats.compiled++;
+  }
+
+  if(n != entry.arity) {
+    return false;
+  }
+  int64_t local[8];
+  std::vector<int64_t> spill;
+  int64_t* slots = local;
+  if(n > 8) {
+    spill.resize(n);
+    slots = spill.data();
+  }
+  for(size_t i = 0; i < n; i++) {
+    if(!args[i].isInteger()) {
+      jit.stats.guardFailures++;
+      return false;
+    }
+    slots[i] = args[i].asIntegerUnsafe();
+  }
+
+  uint64_t ret = entry.code(slots);
+  if(ret & jitBailout) {
+    jit.stats.bailouts++;
+    return false;
+  }
+  jit.stats.nativeCalls++;
+  result = entry.returnsBool ? vm.makeBool(ret != 0) : vm.makeInteger((int32_t)(uint32_t)ret);
+  return true;
+}
@@ -0,0 +1,77 @@
+#ifndef MYLISP_JIT_H_
+#define MYLISP_JIT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <unordered_map>
+#include <vector>
+
+#include "value.h"
+
+// Off interprets everything, On compiles lambdas once they've been called
+// jitThreshold times and Always compiles them on their first call.
+enum class JitMode {
+  Off,
+  On,
+  Always
+};
+
+const unsigned jitThreshold = 1000;
+
+class JitStats {
+public:
+  size_t compiled = 0;
+  size_t rejected = 0;
+  size_t nativeCalls = 0;
+  size_t guardFailures = 0;
+  size_t bailouts = 0;
+};
+
+// Returns the result in the low 32 bits, or jitBailout when the code hit
+// something only the interpreter can deal with.
+typedef uint64_t (*JitCode)(const int64_t* args);
+
+const uint64_t jitBailout = (uint64_t)1 << 32;
+
+// Native code for the lambdas of one VM, by closure.  Code is only
+// generated for closures whose bodies are integer arithmetic, eq?, if and
+// calls to themselves, with integer parameters; everything else stays
+// interpreted.
+class Jit {
+public:
+  class Entry {
+  public:
+    unsigned calls = 0;
+    bool tried = false;
+    JitCode code = 0;
+    size_t arity = 0;
+    bool returnsBool = false;
+  };
+
+  std::unordered_map<Object*, Entry> entries;
+  JitStats stats;
+
+  ~Jit();
+
+  void* allocCode(const void* code, size_t size);
+
+private:
+  class Pages {
+  public:
+    void* data;
+    size_t size;
+  };
+
+  std::vector<Pages> pages;
+};
+
+// Calls `lambda` through its native code if it has some, or gets some now.
+// Returns false when the call has to be interpreted instead, including when
+// an argument fails the integer guard or the code bails out; neither has
+// side effects to undo, since compiled code can't have any.
+bool jit_call(VM& vm, Value lambda, const Value* args, size_t n, Value& result);
+
+JitStats jit_stats(VM& vm);
+
+#endif
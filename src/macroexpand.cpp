@@ -0,0 +1,46 @@
+#include <vector>
+
+#include "macroexpand.h"
+#include "builtin.h"
+#include "vm.h"
+
+static Value expand_list(VM& vm, Value list, Value macros) {
+  std::vector<Value> cells;
+  std::vector<Value> items;
+  Value tail = list;
+  for(; tail.isCons(); tail = tail.asConsUnsafe().rest) {
+    cells.push_back(tail);
+    items.push_back(macroexpand(vm, tail.asConsUnsafe().first, macros));
+  }
+
+  // Cells are rebuilt only from the last one that changed.
+  Value result = macroexpand(vm, tail, macros);
+  bool same = result.getObj() == tail.getObj();
+  for(size_t i = cells.size(); i > 0; i--) {
+    if(same && items[i - 1].getObj() == cells[i - 1].asConsUnsafe().first.getObj()) {
+      result = cells[i - 1];
+    } else {
+      same = false;
+      result = vm.makeCons(items[i - 1], result);
+    }
+  }
+  return result;
+}
+
+Value macroexpand(VM& vm, Value program, Value macros) {
+  while(program.isCons()) {
+    Value head = program.asConsUnsafe().first;
+    Value macro;
+    if(!head.isSymbol() || head == vm.syms.quote || !hashmap_find(macros, head, macro)) {
+      return expand_list(vm, program, macros);
+    }
+    program = apply(vm, macro, &program, 1);
+  }
+  return program;
+}
+
+Value builtin_macroexpand(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2);
+  args[1].asHashMap(vm);
+  return macroexpand(vm, args[0], args[1]);
+}
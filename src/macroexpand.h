@@ -0,0 +1,13 @@
+#ifndef MYLISP_MACROEXPAND_H_
+#define MYLISP_MACROEXPAND_H_
+
+#include "value.h"
+
+// Expands every form whose head is a symbol bound in `macros`, a hash map
+// from symbols to macro functions, by calling the function on the form and
+// expanding what it returns.  Other forms are expanded item by item,
+// including the arguments of quote.  Subtrees that expand to themselves are
+// returned as is rather than copied.
+Value macroexpand(VM& vm, Value program, Value macros);
+
+#endif
@@ -0,0 +1,118 @@
+#include "memo.h"
+#include "builtin.h"
+#include "vm.h"
+
+// Entries are added as calls are made rather than reserved up front, since
+// the capacity is whatever the program asked for.
+MemoCache::MemoCache(size_t capacity): capacity(capacity) {}
+
+bool MemoCache::find(Value args, uint32_t hash, Value& result) {
+  std::lock_guard<std::mutex> guard(lock);
+  auto range = index.equal_range(hash);
+  for(auto it = range.first; it != range.second; ++it) {
+    Entry& entry = entries[it->second];
+    if(entry.args == args) {
+      entry.referenced = true;
+      result = entry.result;
+      stats.hits++;
+      return true;
+    }
+  }
+  stats.misses++;
+  return false;
+}
+
+void MemoCache::insert(Value args, uint32_t hash, Value result) {
+  std::lock_guard<std::mutex> guard(lock);
+
+  // Another thread may have computed the same call in the meantime.
+  auto range = index.equal_range(hash);
+  for(auto it = range.first; it != range.second; ++it) {
+    if(entries[it->second].args == args) {
+      return;
+    }
+  }
+
+  size_t slot;
+  if(entries.size() < capacity) {
+    slot = entries.size();
+    entries.push_back(Entry());
+  } else {
+    while(entries[hand].referenced) {
+      entries[hand].referenced = false;
+      hand = (hand + 1) % capacity;
+    }
+    slot = hand;
+    hand = (hand + 1) % capacity;
+
+    auto victims = index.equal_range(entries[slot].hash);
+    for(auto it = victims.first; it != victims.second; ++it) {
+      if(it->second == slot) {
+        index.erase(it);
+        break;
+      }
+    }
+    stats.evictions++;
+  }
+
+  Entry& entry = entries[slot];
+  entry.args = args;
+  entry.result = result;
+  entry.hash = hash;
+  entry.referenced = false;
+  index.insert(std::make_pair(hash, slot));
+}
+
+void MemoCache::clear() {
+  std::lock_guard<std::mutex> guard(lock);
+  entries.clear();
+  index.clear();
+  hand = 0;
+}
+
+MemoStats MemoCache::snapshot() {
+  std::lock_guard<std::mutex> guard(lock);
+  return stats;
+}
+
+Value make_memoized(VM& vm, Value func, size_t capacity) {
+  VM_EXPECT(vm, func.isLambda() || func.isBuiltin() || func.isMemoized() || func.isCompiled());
+  VM_EXPECT(vm, capacity > 0);
+  Value o = new(vm, Object::Type::Memoized) Object;
+  o->as_memoized.func = func;
+  o->as_memoized.cache = vm.registerMemoCache(new MemoCache(capacity));
+  return o;
+}
+
+Value memo_call(VM& vm, Value memoized, Value args) {
+  Memoized& m = memoized.asMemoizedUnsafe();
+  uint32_t hash = value_hash(args);
+  Value result;
+  if(m.cache->find(args, hash, result)) {
+    return result;
+  }
+  result = apply(vm, m.func, args);
+  m.cache->insert(args, hash, result);
+  return result;
+}
+
+// (memoize func [capacity])
+Value builtin_memoize(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 1 || n == 2);
+  size_t capacity = defaultMemoCapacity;
+  if(n == 2) {
+    int requested = args[1].asInteger(vm);
+    VM_EXPECT(vm, requested > 0);
+    capacity = requested;
+  }
+  return make_memoized(vm, args[0], capacity);
+}
+
+Value builtin_memo_stats(VM& vm, const Value* args, size_t n) {
+  Memoized& m = singleValue(vm, args, n).asMemoized(vm);
+  MemoStats stats = m.cache->snapshot();
+  return vm.makeList(
+    vm.makeCons(vm.makeSymbol("hits"), vm.makeInteger(stats.hits)),
+    vm.makeCons(vm.makeSymbol("misses"), vm.makeInteger(stats.misses)),
+    vm.makeCons(vm.makeSymbol("evictions"), vm.makeInteger(stats.evictions)));
+}
@@ -0,0 +1,62 @@
+#ifndef MYLISP_MEMO_H_
+#define MYLISP_MEMO_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "value.h"
+
+class MemoStats {
+public:
+  size_t hits = 0;
+  size_t misses = 0;
+  size_t evictions = 0;
+};
+
+// A fixed-capacity cache from argument lists to results, compared with ==
+// and replaced in CLOCK order: each entry gets a second chance if it was
+// hit since the hand last passed it.  Values are immutable, so a cached
+// result can be handed out any number of times.
+class MemoCache {
+private:
+  class Entry {
+  public:
+    Value args;
+    Value result;
+    uint32_t hash;
+    bool referenced;
+  };
+
+  std::mutex lock;
+  std::vector<Entry> entries;
+  std::unordered_multimap<uint32_t, size_t> index;
+  size_t hand = 0;
+
+public:
+  const size_t capacity;
+  MemoStats stats;
+
+  // Caches are owned by the root VM, which keeps them in a list.
+  MemoCache* next = 0;
+
+  MemoCache(size_t capacity);
+
+  bool find(Value args, uint32_t hash, Value& result);
+  void insert(Value args, uint32_t hash, Value result);
+  MemoStats snapshot();
+
+  // Drops every entry, keeping the stats.
+  void clear();
+};
+
+const size_t defaultMemoCapacity = 1024;
+
+Value make_memoized(VM& vm, Value func, size_t capacity);
+
+Value memo_call(VM& vm, Value memoized, Value args);
+
+#endif
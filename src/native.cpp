@@ -0,0 +1,66 @@
+#include <dlfcn.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+#include "native.h"
+#include "hashmap.h"
+#include "compiled.h"
+
+static const char nativePrefix[] = "native/";
+
+NativeModule::NativeModule(VM& vm): vm(vm), exports(make_hashmap(vm)) {}
+
+void NativeModule::define(const char* name, BuiltinFunc func) {
+  exports = hashmap_assoc(vm, exports, vm.makeSymbol(String(name)), make_builtin(vm, name, func));
+}
+
+bool is_native_module(Value name) {
+  if(!name.isSymbol()) {
+    return false;
+  }
+  const String& str = name.asSymbolUnsafe();
+  size_t length = strlen(nativePrefix);
+  return str.length > length && memcmp(str.text, nativePrefix, length) == 0;
+}
+
+static Value builtin_native_export(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2);
+  return map_lookup(vm, args[0], args[1]);
+}
+
+Value load_native_module(VM& vm, Value name) {
+  const String& str = name.asSymbol(vm);
+  size_t length = strlen(nativePrefix);
+  std::string path(str.text + length, str.length - length);
+  if(path.find('/') == std::string::npos) {
+    path = "./" + path;
+  }
+  path += ".so";
+
+  void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if(!handle) {
+    std::string message = std::string("can't load native module: ") + dlerror();
+    VM_ERROR(vm, message.c_str());
+  }
+  // Modules compiled by --compile-c evaluate to a module function like
+  // interpreted ones do.
+  CompiledModuleEntry entry = (CompiledModuleEntry)dlsym(handle, COMPILED_MODULE_ENTRY);
+  if(entry) {
+    Value moduleFunc;
+    entry(vm, &moduleFunc);
+    return apply(vm, moduleFunc, &vm.objs.builtin_load_module, 1);
+  }
+  NativeModuleInit init = (NativeModuleInit)dlsym(handle, NATIVE_MODULE_INIT);
+  VM_EXPECT(vm, init != 0);
+
+  NativeModule module(vm);
+  init(module);
+
+  // (lambda (sym) (native-export 'exports sym))
+  Value sym = vm.makeSymbol("sym");
+  Value lookup = make_builtin(vm, "native-export", builtin_native_export);
+  Value body = vm.makeList(lookup, vm.makeList(vm.syms.quote, module.exports), sym);
+  return make_lambda(vm, vm.makeList(sym), body, vm.nil);
+}
@@ -0,0 +1,38 @@
+#ifndef MYLISP_NATIVE_H_
+#define MYLISP_NATIVE_H_
+
+#include "bind.h"
+
+// Modules named native/<path> are shared objects: loading one dlopens
+// <path>.so and calls its entry point, which defines the builtins the module
+// exports.  The object is never unloaded, so builtin names can be string
+// literals.
+//
+//   extern "C" void mylisp_init_module(NativeModule& module) {
+//     module.define("fib", BIND_BUILTIN(fib));
+//   }
+//
+// Modules compiled by --compile-c are loaded the same way.
+//
+// Extensions call into the interpreter, so executables that load them have
+// to export their symbols (-rdynamic).
+class NativeModule {
+public:
+  VM& vm;
+  Value exports;
+
+  NativeModule(VM& vm);
+
+  void define(const char* name, BuiltinFunc func);
+};
+
+typedef void (*NativeModuleInit)(NativeModule& module);
+
+#define NATIVE_MODULE_INIT "mylisp_init_module"
+
+bool is_native_module(Value name);
+
+// Returns the module function, which maps export names to builtins.
+Value load_native_module(VM& vm, Value name);
+
+#endif
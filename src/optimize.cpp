@@ -0,0 +1,671 @@
+#include <chrono>
+#include <vector>
+
+#include "optimize.h"
+#include "builtin.h"
+#include "vm.h"
+
+static bool is_keyword(VM& vm, Value sym) {
+  return sym == vm.syms.if_ || sym == vm.syms.letlambdas || sym == vm.syms.import || sym == vm.syms.quote;
+}
+
+static bool is_literal(Value e) {
+  return e.isInteger() || e.isNil() || e.isBuiltin() || e.isBool() || e.isLambda() || e.isString() || e.isMemoized();
+}
+
+static size_t node_count(Value e) {
+  size_t count = 0;
+  while(e.isCons()) {
+    count += 1 + node_count(e->as_cons.first);
+    e = e->as_cons.rest;
+  }
+  return count;
+}
+
+static bool list_to_vector(Value list, std::vector<Value>& out) {
+  while(list.isCons()) {
+    out.push_back(list->as_cons.first);
+    list = list->as_cons.rest;
+  }
+  return list.isNil();
+}
+
+static Value vector_to_list(VM& vm, const std::vector<Value>& items) {
+  Value list = vm.nil;
+  for(size_t i = items.size(); i > 0; i--) {
+    list = vm.makeCons(items[i - 1], list);
+  }
+  return list;
+}
+
+// Reads the `count` items following the head of `form`, which must have
+// exactly that many.
+static bool form_items(Value form, Value* items, size_t count) {
+  Value p = form->as_cons.rest;
+  for(size_t i = 0; i < count; i++) {
+    if(!p.isCons()) {
+      return false;
+    }
+    items[i] = p->as_cons.first;
+    p = p->as_cons.rest;
+  }
+  return p.isNil();
+}
+
+static bool is_quote(VM& vm, Value e) {
+  Value datum;
+  return e.isCons() && e->as_cons.first == vm.syms.quote && form_items(e, &datum, 1);
+}
+
+static bool is_constant(VM& vm, Value e) {
+  return is_literal(e) || is_quote(vm, e);
+}
+
+static Value constant_value(VM& vm, Value e) {
+  return is_literal(e) ? e : e->as_cons.rest->as_cons.first;
+}
+
+template<class Func>
+static bool for_each_param(Value params, Func func) {
+  while(params.isCons()) {
+    Value p = params->as_cons.first;
+    if(!p.isSymbol()) {
+      return false;
+    }
+    func(p);
+    params = params->as_cons.rest;
+  }
+  if(params.isSymbol()) {
+    func(params);
+    return true;
+  }
+  return params.isNil();
+}
+
+static bool binds(Value params, Value sym) {
+  bool found = false;
+  for_each_param(params, [&found, &sym](Value p) {
+    found = found || p == sym;
+  });
+  return found;
+}
+
+class Definition {
+public:
+  Value name;
+  Value params;
+  Value body;
+};
+
+static bool parse_definition(Value def, Definition& out) {
+  if(!def.isCons()) {
+    return false;
+  }
+  Value head = def->as_cons.first;
+  Value rest = def->as_cons.rest;
+  if(!head.isCons() || !head->as_cons.first.isSymbol() || !rest.isCons() || !rest->as_cons.rest.isNil()) {
+    return false;
+  }
+  out.name = head->as_cons.first;
+  out.params = head->as_cons.rest;
+  out.body = rest->as_cons.first;
+  return for_each_param(out.params, [](Value p) {});
+}
+
+static bool parse_letlambdas(Value form, std::vector<Definition>& defs, Value& body) {
+  Value items[2];
+  if(!form_items(form, items, 2)) {
+    return false;
+  }
+  Value p = items[0];
+  while(p.isCons()) {
+    Definition def;
+    if(!parse_definition(p->as_cons.first, def)) {
+      return false;
+    }
+    defs.push_back(def);
+    p = p->as_cons.rest;
+  }
+  body = items[1];
+  return p.isNil();
+}
+
+static Value make_definition(VM& vm, const Definition& def) {
+  return vm.makeList(vm.makeCons(def.name, def.params), def.body);
+}
+
+static Value make_letlambdas(VM& vm, const std::vector<Definition>& defs, Value body) {
+  std::vector<Value> items;
+  for(const Definition& def : defs) {
+    items.push_back(make_definition(vm, def));
+  }
+  return vm.makeList(vm.syms.letlambdas, vector_to_list(vm, items), body);
+}
+
+// Maps `func` over the items of a list and the tail of a dotted one, sharing
+// the input when nothing changes.
+template<class Func>
+static Value map_items(VM& vm, Value list, Func func) {
+  if(!list.isCons()) {
+    return func(list);
+  }
+  Value first = func(list->as_cons.first);
+  Value rest = map_items(vm, list->as_cons.rest, func);
+  if(first.getObj() == list->as_cons.first.getObj() && rest.getObj() == list->as_cons.rest.getObj()) {
+    return list;
+  }
+  return vm.makeCons(first, rest);
+}
+
+static bool mentions(Value e, Value sym) {
+  if(e.isSymbol()) {
+    return e == sym;
+  }
+  return e.isCons() && (mentions(e->as_cons.first, sym) || mentions(e->as_cons.rest, sym));
+}
+
+static bool occurs_free(VM& vm, Value sym, Value e);
+
+static bool occurs_free_in_items(VM& vm, Value sym, Value items) {
+  for(; items.isCons(); items = items->as_cons.rest) {
+    if(occurs_free(vm, sym, items->as_cons.first)) {
+      return true;
+    }
+  }
+  return occurs_free(vm, sym, items);
+}
+
+// Forms that don't parse are left alone, so for those any mention counts.
+static bool occurs_free(VM& vm, Value sym, Value e) {
+  if(e.isSymbol()) {
+    return e == sym;
+  } else if(!e.isCons()) {
+    return false;
+  }
+  Value head = e->as_cons.first;
+  if(head == vm.syms.quote || head == vm.syms.import) {
+    return false;
+  } else if(head == vm.syms.letlambdas) {
+    std::vector<Definition> defs;
+    Value body;
+    if(!parse_letlambdas(e, defs, body)) {
+      return mentions(e, sym);
+    }
+    for(const Definition& def : defs) {
+      if(def.name == sym) {
+        return false;
+      }
+    }
+    for(const Definition& def : defs) {
+      if(!binds(def.params, sym) && occurs_free(vm, sym, def.body)) {
+        return true;
+      }
+    }
+    return occurs_free(vm, sym, body);
+  }
+  return occurs_free_in_items(vm, sym, e);
+}
+
+// Replaces free occurrences of `param` in `e` with `arg`, clearing `ok` if a
+// binder in `e` would capture a variable `arg`.
+static Value substitute(VM& vm, Value e, Value param, Value arg, bool& ok) {
+  if(e.isSymbol()) {
+    return e == param ? arg : e;
+  } else if(!e.isCons() || !ok) {
+    return e;
+  }
+  Value head = e->as_cons.first;
+  if(head == vm.syms.quote || head == vm.syms.import) {
+    return e;
+  } else if(head == vm.syms.letlambdas) {
+    std::vector<Definition> defs;
+    Value body;
+    if(!parse_letlambdas(e, defs, body)) {
+      ok = ok && !mentions(e, param);
+      return e;
+    }
+    for(const Definition& def : defs) {
+      if(def.name == param) {
+        return e;
+      }
+      if(def.name == arg && occurs_free(vm, param, e)) {
+        ok = false;
+        return e;
+      }
+    }
+    for(Definition& def : defs) {
+      if(binds(def.params, param)) {
+        continue;
+      }
+      if(arg.isSymbol() && binds(def.params, arg) && occurs_free(vm, param, def.body)) {
+        ok = false;
+        return e;
+      }
+      def.body = substitute(vm, def.body, param, arg, ok);
+    }
+    return make_letlambdas(vm, defs, substitute(vm, body, param, arg, ok));
+  }
+  return map_items(vm, e, [&vm, &param, &arg, &ok](Value item) {
+    return substitute(vm, item, param, arg, ok);
+  });
+}
+
+static bool foldable(BuiltinFunc func, const std::vector<Value>& args) {
+  bool integers = true;
+  for(const Value& arg : args) {
+    integers = integers && arg.isInteger();
+  }
+  if(func == builtin_add || func == builtin_mul) {
+    return integers;
+  } else if(func == builtin_sub) {
+    return integers && args.size() >= 1;
+  } else if(func == builtin_div || func == builtin_modulo) {
+    if(!integers || args.size() < 1 || (func == builtin_modulo && args.size() != 2)) {
+      return false;
+    }
+    for(size_t i = 1; i < args.size(); i++) {
+      int divisor = args[i].asIntegerUnsafe();
+      if(divisor == 0 || divisor == -1) {
+        return false;
+      }
+    }
+    return true;
+  } else if(func == builtin_is_equal) {
+    return args.size() == 2;
+  } else if(func == builtin_constructor) {
+    return args.size() == 1;
+  } else if(func == builtin_string_length) {
+    return args.size() == 1 && args[0].isString();
+  } else if(func == builtin_int_to_string) {
+    return args.size() == 1 && integers;
+  }
+  return false;
+}
+
+class Optimizer {
+private:
+  class Binding {
+  public:
+    Definition def;
+    bool inlinable;
+  };
+
+  typedef std::vector<Binding> Scope;
+
+  VM& vm;
+  const OptimizeOptions& options;
+  OptimizeStats& stats;
+  std::chrono::steady_clock::time_point deadline;
+  std::vector<Scope> scopes;
+  size_t growthLeft = 0;
+  size_t changes = 0;
+
+  bool outOfTime() {
+    return std::chrono::steady_clock::now() > deadline;
+  }
+
+  bool isBound(Value sym) {
+    for(const Scope& scope : scopes) {
+      for(const Binding& binding : scope) {
+        if(binding.def.name == sym) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  // Arguments that can be substituted for a parameter: evaluating them has
+  // no effects and gives the same value wherever they are evaluated in
+  // scope.  Unbound variables and unknown imports raise errors, so they
+  // have to stay where they are.
+  bool isTrivial(Value e) {
+    Value items[2];
+    if(e.isSymbol()) {
+      return !is_keyword(vm, e) && isBound(e);
+    }
+    if(e.isCons() && e->as_cons.first == vm.syms.import && form_items(e, items, 2)) {
+      return items[0] == vm.syms.core && map_lookup_or_else(vm, vm.core_imports, items[1], [](Value key)->Value {
+        return Value();
+      }).getObj() != 0;
+    }
+    return is_constant(vm, e);
+  }
+
+  // Only leaf definitions are inlined: ones that don't refer to themselves or
+  // to anything else they are defined together with.
+  bool isInlinable(const Definition& def, const std::vector<Definition>& group) {
+    std::vector<Value> params;
+    if(!list_to_vector(def.params, params) || node_count(def.body) > options.inlineLimit) {
+      return false;
+    }
+    for(const Definition& other : group) {
+      if(!binds(def.params, other.name) && occurs_free(vm, other.name, def.body)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Substitutes the trivial arguments of a call to `def` into its body.
+  // Parameters that can't be substituted are left in `keptParams` and
+  // `keptArgs`.  Returns an empty value if the call doesn't qualify.
+  Value beta(const Definition& def, Value args, std::vector<Value>& keptParams, std::vector<Value>& keptArgs) {
+    std::vector<Value> params;
+    std::vector<Value> values;
+    if(!list_to_vector(def.params, params) || !list_to_vector(args, values) || params.size() != values.size()) {
+      return Value();
+    }
+    for(size_t i = 0; i < params.size(); i++) {
+      if(is_keyword(vm, params[i])) {
+        return Value();
+      }
+      for(size_t j = 0; j < i; j++) {
+        if(params[i] == params[j]) {
+          return Value();
+        }
+      }
+    }
+    if(occurs_free(vm, def.name, def.body) || occurs_free_in_items(vm, def.name, args)) {
+      return Value();
+    }
+
+    Value body = def.body;
+    for(size_t i = 0; i < params.size(); i++) {
+      Value arg = values[i];
+      bool ok = isTrivial(arg) && !(arg.isSymbol() && binds(def.params, arg));
+      if(ok) {
+        Value substituted = substitute(vm, body, params[i], arg, ok);
+        if(ok) {
+          body = substituted;
+          continue;
+        }
+      }
+      keptParams.push_back(params[i]);
+      keptArgs.push_back(arg);
+    }
+    return body;
+  }
+
+  // (letlambdas (((current-let params...) body)) (current-let args...))
+  Value reduceLet(Value form) {
+    std::vector<Definition> defs;
+    Value body;
+    if(!parse_letlambdas(form, defs, body) || defs.size() != 1 ||
+        !body.isCons() || body->as_cons.first != defs[0].name) {
+      return form;
+    }
+    Definition def = defs[0];
+    std::vector<Value> keptParams;
+    std::vector<Value> keptArgs;
+    Value reduced = beta(def, body->as_cons.rest, keptParams, keptArgs);
+    if(reduced.getObj() == 0 || (!keptParams.empty() && keptParams.size() == list_length(def.params))) {
+      return form;
+    }
+    changes++;
+    stats.betaReductions++;
+    if(keptParams.empty()) {
+      return reduced;
+    }
+    def.params = vector_to_list(vm, keptParams);
+    def.body = reduced;
+    return vm.makeList(vm.syms.letlambdas,
+      vm.makeList(make_definition(vm, def)),
+      vm.makeCons(def.name, vector_to_list(vm, keptArgs)));
+  }
+
+  Value walkImport(Value form) {
+    Value items[2];
+    if(!form_items(form, items, 2)) {
+      return form;
+    }
+    Value found = map_lookup_or_else(vm, vm.core_imports, items[1], [](Value key)->Value {
+      return Value();
+    });
+    if(found.getObj() == 0 || !is_literal(found)) {
+      return form;
+    }
+    changes++;
+    stats.folds++;
+    return found;
+  }
+
+  Value walkIf(Value form) {
+    Value items[3];
+    if(!form_items(form, items, 3)) {
+      return form;
+    }
+    Value cond = walk(items[0]);
+    if(cond.isBool()) {
+      changes++;
+      stats.folds++;
+      return walk(cond.asBoolUnsafe() ? items[1] : items[2]);
+    }
+    return vm.makeList(vm.syms.if_, cond, walk(items[1]), walk(items[2]));
+  }
+
+  Value walkLetLambdas(Value form) {
+    std::vector<Definition> defs;
+    Value body;
+    if(!parse_letlambdas(form, defs, body)) {
+      return form;
+    }
+
+    // The definition of a let is beta-reduced as a whole instead.
+    bool let = defs.size() == 1 && body.isCons() && body->as_cons.first == defs[0].name;
+    Scope scope;
+    for(const Definition& def : defs) {
+      scope.push_back(Binding{def, !let && isInlinable(def, defs)});
+    }
+    scopes.push_back(scope);
+    for(Definition& def : defs) {
+      Scope params;
+      for_each_param(def.params, [&params](Value p) {
+        params.push_back(Binding{Definition{p, Value(), Value()}, false});
+      });
+      scopes.push_back(params);
+      def.body = walk(def.body);
+      scopes.pop_back();
+    }
+    body = walk(body);
+    scopes.pop_back();
+
+    return reduceLet(removeDeadBindings(defs, body));
+  }
+
+  Value removeDeadBindings(const std::vector<Definition>& defs, Value body) {
+    for(size_t i = 0; i < defs.size(); i++) {
+      for(size_t j = 0; j < i; j++) {
+        if(defs[i].name == defs[j].name) {
+          return make_letlambdas(vm, defs, body);
+        }
+      }
+    }
+
+    std::vector<bool> live(defs.size(), false);
+    for(size_t i = 0; i < defs.size(); i++) {
+      live[i] = occurs_free(vm, defs[i].name, body);
+    }
+    bool grew = true;
+    while(grew) {
+      grew = false;
+      for(size_t i = 0; i < defs.size(); i++) {
+        if(!live[i]) {
+          continue;
+        }
+        for(size_t j = 0; j < defs.size(); j++) {
+          if(!live[j] && !binds(defs[i].params, defs[j].name) && occurs_free(vm, defs[j].name, defs[i].body)) {
+            live[j] = true;
+            grew = true;
+          }
+        }
+      }
+    }
+
+    std::vector<Definition> kept;
+    for(size_t i = 0; i < defs.size(); i++) {
+      if(live[i]) {
+        kept.push_back(defs[i]);
+      }
+    }
+    if(kept.size() != defs.size()) {
+      changes++;
+      stats.removedBindings += defs.size() - kept.size();
+    }
+    if(kept.empty()) {
+      return body;
+    }
+    return make_letlambdas(vm, kept, body);
+  }
+
+  Value walkCall(Value form) {
+    Value call = map_items(vm, form, [this](Value item) {
+      return walk(item);
+    });
+    Value head = call->as_cons.first;
+    std::vector<Value> args;
+    if(!list_to_vector(call->as_cons.rest, args)) {
+      return call;
+    }
+    if(head.isBuiltin()) {
+      return fold(call, args);
+    } else if(head.isSymbol()) {
+      return inlineCall(call, args);
+    } else if(head.isCons() && head->as_cons.first == vm.syms.letlambdas) {
+      return applyLambda(call);
+    }
+    return call;
+  }
+
+  Value fold(Value call, const std::vector<Value>& args) {
+    std::vector<Value> values;
+    for(const Value& arg : args) {
+      if(!is_constant(vm, arg)) {
+        return call;
+      }
+      values.push_back(constant_value(vm, arg));
+    }
+    BuiltinFunc func = builtin_func(call->as_cons.first);
+    if(!foldable(func, values)) {
+      return call;
+    }
+    Value result = func(vm, values.data(), values.size());
+    changes++;
+    stats.folds++;
+    return is_literal(result) ? result : vm.makeList(vm.syms.quote, result);
+  }
+
+  // ((letlambdas (((current-lambda params...) body)) current-lambda) args...)
+  // is the same as a let.
+  Value applyLambda(Value call) {
+    Value head = call->as_cons.first;
+    std::vector<Definition> defs;
+    Value body;
+    if(!parse_letlambdas(head, defs, body) || defs.size() != 1 || body != defs[0].name ||
+        occurs_free_in_items(vm, defs[0].name, call->as_cons.rest)) {
+      return call;
+    }
+    Value let = vm.makeList(vm.syms.letlambdas,
+      head->as_cons.rest->as_cons.first,
+      vm.makeCons(defs[0].name, call->as_cons.rest));
+    Value reduced = reduceLet(let);
+    return reduced.getObj() == let.getObj() ? call : reduced;
+  }
+
+  Value inlineCall(Value call, const std::vector<Value>& args) {
+    Value name = call->as_cons.first;
+    size_t depth = scopes.size();
+    const Binding* found = 0;
+    while(depth > 0 && !found) {
+      depth--;
+      for(const Binding& binding : scopes[depth]) {
+        if(binding.def.name == name) {
+          found = &binding;
+          break;
+        }
+      }
+    }
+    if(!found || !found->inlinable || outOfTime()) {
+      return call;
+    }
+    for(const Value& arg : args) {
+      if(!isTrivial(arg)) {
+        return call;
+      }
+    }
+    Definition def = found->def;
+
+    // The body's free variables have to mean the same at the call site.
+    for(size_t i = depth + 1; i < scopes.size(); i++) {
+      for(const Binding& binding : scopes[i]) {
+        if(!binds(def.params, binding.def.name) && occurs_free(vm, binding.def.name, def.body)) {
+          return call;
+        }
+      }
+    }
+
+    size_t size = node_count(def.body);
+    size_t callSize = node_count(call);
+    size_t growth = size > callSize ? size - callSize : 0;
+    if(growth > growthLeft) {
+      return call;
+    }
+
+    std::vector<Value> keptParams;
+    std::vector<Value> keptArgs;
+    Value inlined = beta(def, call->as_cons.rest, keptParams, keptArgs);
+    if(inlined.getObj() == 0 || !keptParams.empty()) {
+      return call;
+    }
+    growthLeft -= growth;
+    changes++;
+    stats.inlines++;
+    return inlined;
+  }
+
+  Value walk(Value e) {
+    if(!e.isCons()) {
+      return e;
+    }
+    Value head = e->as_cons.first;
+    if(head == vm.syms.quote) {
+      return e;
+    } else if(head == vm.syms.import) {
+      return walkImport(e);
+    } else if(head == vm.syms.if_) {
+      return walkIf(e);
+    } else if(head == vm.syms.letlambdas) {
+      return walkLetLambdas(e);
+    }
+    return walkCall(e);
+  }
+
+public:
+  Optimizer(VM& vm, const OptimizeOptions& options, OptimizeStats& stats):
+    vm(vm), options(options), stats(stats) {}
+
+  Value run(Value program) {
+    stats.sizeBefore = node_count(program);
+    growthLeft = stats.sizeBefore * options.growthPercent / 100;
+    deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(options.budgetMillis);
+    while(stats.passes < options.maxPasses) {
+      changes = 0;
+      program = walk(program);
+      stats.passes++;
+      if(changes == 0 || outOfTime()) {
+        break;
+      }
+    }
+    stats.sizeAfter = node_count(program);
+    return program;
+  }
+};
+
+Value optimize(VM& vm, Value program, const OptimizeOptions& options, OptimizeStats* stats) {
+  OptimizeStats local;
+  if(!stats) {
+    stats = &local;
+  }
+  *stats = OptimizeStats();
+  return Optimizer(vm, options, *stats).run(program);
+}
@@ -0,0 +1,39 @@
+#ifndef MYLISP_OPTIMIZE_H_
+#define MYLISP_OPTIMIZE_H_
+
+#include <stddef.h>
+
+#include "value.h"
+
+class OptimizeOptions {
+public:
+  // Passes run until one changes nothing, or until either budget runs out.
+  size_t maxPasses = 8;
+  unsigned budgetMillis = 50;
+
+  // Largest definition body, in cons cells, that is inlined at a call site.
+  size_t inlineLimit = 24;
+
+  // How much inlining may grow the program, as a percentage of its input size.
+  size_t growthPercent = 50;
+};
+
+class OptimizeStats {
+public:
+  size_t passes = 0;
+  size_t betaReductions = 0;
+  size_t folds = 0;
+  size_t inlines = 0;
+  size_t removedBindings = 0;
+  size_t sizeBefore = 0;
+  size_t sizeAfter = 0;
+};
+
+// Simplifies transformed code (the letlambdas IR) without changing what it
+// evaluates to: lets and immediately applied lambdas whose arguments are
+// constants or variables are beta-reduced, calls of core builtins on
+// constants are folded, small non-recursive definitions are inlined and
+// definitions nothing refers to are dropped.
+Value optimize(VM& vm, Value program, const OptimizeOptions& options = OptimizeOptions(), OptimizeStats* stats = 0);
+
+#endif
@@ -0,0 +1,273 @@
+#include <memory>
+
+#include "parallel.h"
+#include "builtin.h"
+#include "vm.h"
+
+static thread_local ThreadPool* currentPool = 0;
+static thread_local size_t currentQueue = 0;
+
+ThreadPool::ThreadPool(size_t size):
+  nextQueue(0),
+  pending(0),
+  stopping(false)
+{
+  for(size_t i = 0; i < size; i++) {
+    queues.push_back(new Queue());
+  }
+  for(size_t i = 0; i < size; i++) {
+    threads.push_back(std::thread(&ThreadPool::workerLoop, this, i));
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> guard(sleepLock);
+    stopping = true;
+  }
+  wakeup.notify_all();
+  for(size_t i = 0; i < threads.size(); i++) {
+    threads[i].join();
+  }
+  for(size_t i = 0; i < queues.size(); i++) {
+    delete queues[i];
+  }
+}
+
+size_t ThreadPool::defaultSize() {
+  size_t cpus = std::thread::hardware_concurrency();
+  return cpus > 2 ? cpus - 1 : 1;
+}
+
+void ThreadPool::submit(Task* task) {
+  size_t index = currentPool == this ? currentQueue : nextQueue++ % queues.size();
+  {
+    std::lock_guard<std::mutex> guard(queues[index]->lock);
+    queues[index]->tasks.push_back(task);
+  }
+  {
+    std::lock_guard<std::mutex> guard(sleepLock);
+    pending++;
+  }
+  wakeup.notify_one();
+}
+
+Task* ThreadPool::take(size_t index) {
+  size_t count = queues.size();
+  for(size_t i = 0; i < count; i++) {
+    size_t q = (index + i) % count;
+    Queue* queue = queues[q];
+    Task* task = 0;
+    {
+      std::lock_guard<std::mutex> guard(queue->lock);
+      if(queue->tasks.empty()) {
+        continue;
+      }
+      if(q == index && currentPool == this) {
+        task = queue->tasks.back();
+        queue->tasks.pop_back();
+      } else {
+        task = queue->tasks.front();
+        queue->tasks.pop_front();
+      }
+    }
+    std::lock_guard<std::mutex> guard(sleepLock);
+    pending--;
+    return task;
+  }
+  return 0;
+}
+
+void ThreadPool::workerLoop(size_t index) {
+  currentPool = this;
+  currentQueue = index;
+  while(true) {
+    Task* task = take(index);
+    if(task) {
+      task->run();
+      continue;
+    }
+    std::unique_lock<std::mutex> guard(sleepLock);
+    wakeup.wait(guard, [this] { return pending > 0 || stopping; });
+    if(stopping) {
+      return;
+    }
+  }
+}
+
+bool ThreadPool::runPending() {
+  Task* task = take(currentPool == this ? currentQueue : nextQueue % queues.size());
+  if(!task) {
+    return false;
+  }
+  task->run();
+  return true;
+}
+
+enum class ChunkKind {
+  Map,
+  Filter,
+  Reduce
+};
+
+// Evaluates `count` items starting at `items`.  For Map and Filter the
+// results are left as a fresh list in head/tail; for Reduce, head holds the
+// accumulator on entry and the folded value on exit.
+static void run_chunk(VM& vm, ChunkKind kind, Value func, Value items, size_t count, Value& head, Value& tail) {
+  if(kind != ChunkKind::Reduce) {
+    head = tail = vm.nil;
+  }
+  while(count > 0) {
+    Cons c = items.asCons(vm);
+    Value item = c.first;
+    items = c.rest;
+    count--;
+
+    Value value = apply(vm, func,
+      kind == ChunkKind::Reduce ? vm.makeList(head, item) : vm.makeList(item));
+    if(kind == ChunkKind::Reduce) {
+      head = value;
+      continue;
+    } else if(kind == ChunkKind::Filter) {
+      if(!value.asBool(vm)) {
+        continue;
+      }
+      value = item;
+    }
+
+    Value cell = vm.makeFreshCons(value, vm.nil);
+    if(tail.isNil()) {
+      head = cell;
+    } else {
+      tail->as_cons.rest = cell;
+    }
+    tail = cell;
+  }
+}
+
+class ChunkTask: public Task {
+public:
+  VM& parent;
+  ChunkKind kind;
+  Value func;
+  Value items;
+  size_t count;
+  std::atomic<size_t>& remaining;
+
+  VM* worker;
+  Value head;
+  Value tail;
+
+  // Set if the chunk raised an error, which the parent raises again.
+  std::unique_ptr<VMError> error;
+
+  ChunkTask(VM& parent, ChunkKind kind, Value func, Value items, size_t count, std::atomic<size_t>& remaining):
+    parent(parent),
+    kind(kind),
+    func(func),
+    items(items),
+    count(count),
+    remaining(remaining),
+    worker(0) {}
+
+  virtual void run() {
+    try {
+      worker = new VM(parent);
+      if(kind == ChunkKind::Reduce) {
+        Cons c = items.asCons(*worker);
+        head = c.first;
+        run_chunk(*worker, kind, func, c.rest, count - 1, head, tail);
+      } else {
+        run_chunk(*worker, kind, func, items, count, head, tail);
+      }
+    } catch(const VMError& e) {
+      error.reset(new VMError(e));
+    }
+    remaining--;
+  }
+};
+
+static Value parallel_apply(VM& vm, ChunkKind kind, Value func, Value init, Value items) {
+  size_t length = list_length(items);
+  size_t chunks = length / parallelGrainSize;
+
+  Value head = init;
+  Value tail = vm.nil;
+  if(chunks < 2) {
+    run_chunk(vm, kind, func, items, length, head, tail);
+    return head;
+  }
+
+  ThreadPool& pool = vm.threadPool();
+  if(chunks > (pool.size() + 1) * 4) {
+    chunks = (pool.size() + 1) * 4;
+  }
+
+  std::atomic<size_t> remaining(chunks);
+  std::vector<std::unique_ptr<ChunkTask>> tasks;
+  for(size_t i = 0; i < chunks; i++) {
+    size_t count = length / chunks + (i < length % chunks ? 1 : 0);
+    tasks.emplace_back(new ChunkTask(vm, kind, func, items, count, remaining));
+    for(size_t j = 0; j < count; j++) {
+      items = items->as_cons.rest;
+    }
+  }
+  for(size_t i = chunks; i > 0; i--) {
+    pool.submit(tasks[i - 1].get());
+  }
+
+  while(remaining > 0) {
+    if(!pool.runPending()) {
+      std::this_thread::yield();
+    }
+  }
+
+  // The workers are all cleaned up before an error is passed on.
+  ChunkTask* failed = 0;
+  for(size_t i = 0; i < chunks; i++) {
+    ChunkTask* task = tasks[i].get();
+    if(task->worker) {
+      vm.adoptHeap(*task->worker);
+      delete task->worker;
+    }
+    if(task->error && !failed) {
+      failed = task;
+    }
+  }
+  if(failed) {
+    throw *failed->error;
+  }
+
+  head = kind == ChunkKind::Reduce ? init : vm.nil;
+  for(size_t i = 0; i < chunks; i++) {
+    ChunkTask* task = tasks[i].get();
+    if(kind == ChunkKind::Reduce) {
+      head = apply(vm, func, vm.makeList(head, task->head));
+    } else if(!task->head.isNil()) {
+      if(tail.isNil()) {
+        head = task->head;
+      } else {
+        tail->as_cons.rest = task->head;
+      }
+      tail = task->tail;
+    }
+  }
+  return head;
+}
+
+Value builtin_pmap(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2);
+  return parallel_apply(vm, ChunkKind::Map, args[0], vm.nil, args[1]);
+}
+
+Value builtin_pfilter(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2);
+  return parallel_apply(vm, ChunkKind::Filter, args[0], vm.nil, args[1]);
+}
+
+// Chunks are folded independently and their partial results combined left
+// to right, so `func` must be associative.
+Value builtin_preduce(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 3);
+  return parallel_apply(vm, ChunkKind::Reduce, args[0], args[1], args[2]);
+}
@@ -0,0 +1,60 @@
+#ifndef MYLISP_PARALLEL_H_
+#define MYLISP_PARALLEL_H_
+
+#include <stddef.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class Task {
+public:
+  virtual ~Task() {}
+  virtual void run() = 0;
+};
+
+// Each worker owns a deque: it pushes and pops at the back, idle workers
+// steal from the front of everyone else's.
+class ThreadPool {
+private:
+  class Queue {
+  public:
+    std::mutex lock;
+    std::deque<Task*> tasks;
+  };
+
+  std::vector<Queue*> queues;
+  std::vector<std::thread> threads;
+  std::atomic<size_t> nextQueue;
+
+  std::mutex sleepLock;
+  std::condition_variable wakeup;
+  size_t pending;
+  bool stopping;
+
+  Task* take(size_t index);
+  void workerLoop(size_t index);
+
+public:
+  ThreadPool(size_t size);
+  ~ThreadPool();
+
+  static size_t defaultSize();
+
+  inline size_t size() const { return threads.size(); }
+
+  void submit(Task* task);
+
+  // Runs one queued task on the calling thread, returning false if there
+  // was nothing to run.  Callers waiting on their own tasks use this to help
+  // out rather than block, which keeps nested parallel calls deadlock-free.
+  bool runPending();
+};
+
+// Lists shorter than this many elements per chunk are evaluated sequentially.
+const size_t parallelGrainSize = 64;
+
+#endif
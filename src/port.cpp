@@ -0,0 +1,261 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <string>
+
+#include "port.h"
+#include "builtin.h"
+#include "vm.h"
+
+Port::Port(int fd, bool input, bool owned, size_t bufferSize):
+  fd(fd), input(input), owned(owned), buffer(bufferSize) {}
+
+Port::~Port() {
+  if(fd >= 0) {
+    if(!input && end > 0) {
+      iovec iov = {buffer.data(), end};
+      writeAll(&iov, 1);
+    }
+    if(owned) {
+      ::close(fd);
+    }
+  }
+}
+
+bool Port::fill(VM& vm) {
+  VM_EXPECT(vm, input && fd >= 0);
+  if(eof) {
+    return false;
+  }
+  if(begin > 0) {
+    memmove(buffer.data(), buffer.data() + begin, end - begin);
+    end -= begin;
+    begin = 0;
+  }
+  if(end == buffer.size()) {
+    buffer.resize(buffer.size() * 2);
+  }
+  while(true) {
+    ssize_t got = read(fd, buffer.data() + end, buffer.size() - end);
+    if(got < 0 && errno == EINTR) {
+      continue;
+    }
+    VM_EXPECT(vm, got >= 0);
+    if(got == 0) {
+      eof = true;
+      return false;
+    }
+    end += got;
+    return true;
+  }
+}
+
+bool Port::writeAll(iovec* iov, int count) {
+  while(count > 0) {
+    ssize_t written = writev(fd, iov, count);
+    if(written < 0) {
+      if(errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    while(count > 0 && (size_t)written >= iov->iov_len) {
+      written -= iov->iov_len;
+      iov++;
+      count--;
+    }
+    if(count > 0) {
+      iov->iov_base = (char*)iov->iov_base + written;
+      iov->iov_len -= written;
+    }
+  }
+  return true;
+}
+
+void Port::write(VM& vm, const char* data, size_t length) {
+  VM_EXPECT(vm, !input && fd >= 0);
+  if(length <= buffer.size() - end) {
+    memcpy(buffer.data() + end, data, length);
+    end += length;
+    return;
+  }
+  // What is buffered goes out together with the write that didn't fit.
+  if(fd == STDOUT_FILENO) {
+    fflush(stdout);
+  }
+  iovec iov[2] = {{buffer.data(), end}, {(void*)data, length}};
+  end = 0;
+  if(!writeAll(iov, 2)) {
+    VM_ERROR(vm, "write failed");
+  }
+}
+
+void Port::flush(VM& vm) {
+  VM_EXPECT(vm, fd >= 0);
+  if(input || end == 0) {
+    return;
+  }
+  if(fd == STDOUT_FILENO) {
+    fflush(stdout);
+  }
+  iovec iov = {buffer.data(), end};
+  end = 0;
+  if(!writeAll(&iov, 1)) {
+    VM_ERROR(vm, "write failed");
+  }
+}
+
+void Port::close(VM& vm) {
+  if(fd < 0) {
+    return;
+  }
+  flush(vm);
+  if(owned) {
+    ::close(fd);
+  }
+  fd = -1;
+}
+
+Value make_port(VM& vm, Port* port) {
+  Value o = new(vm, Object::Type::Port) Object;
+  o->as_port = port;
+  return o;
+}
+
+static size_t buffer_size(VM& vm, const Value* args, size_t n) {
+  if(n < 2) {
+    return defaultPortBufferSize;
+  }
+  int size = args[1].asInteger(vm);
+  VM_EXPECT(vm, size > 0);
+  return size;
+}
+
+static Value open_port(VM& vm, const Value* args, size_t n, bool input) {
+  VM_EXPECT(vm, n == 1 || n == 2);
+  const String& name = args[0].asString(vm);
+  size_t size = buffer_size(vm, args, n);
+  std::string path(name.text, name.length);
+  int fd = input
+    ? open(path.c_str(), O_RDONLY)
+    : open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if(fd < 0) {
+    std::string message = "can't open " + path + ": " + strerror(errno);
+    VM_ERROR(vm, message.c_str());
+  }
+  return make_port(vm, vm.registerPort(new Port(fd, input, true, size)));
+}
+
+// (open-input-file path [buffer-size])
+Value builtin_open_input_file(VM& vm, const Value* args, size_t n) {
+  return open_port(vm, args, n, true);
+}
+
+// (open-output-file path [buffer-size]) truncates the file.
+Value builtin_open_output_file(VM& vm, const Value* args, size_t n) {
+  return open_port(vm, args, n, false);
+}
+
+// The same port every time, flushed before print writes to stdout.
+Value builtin_standard_output_port(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 0);
+  return make_port(vm, vm.standardOutputPort());
+}
+
+// (read-line port) returns the next line without its newline, or () at end
+// of file.
+Value builtin_read_line(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 1);
+  Port& port = args[0].asPort(vm);
+  VM_EXPECT(vm, port.input && port.fd >= 0);
+  size_t scanned = 0;
+  while(true) {
+    const char* start = port.buffer.data() + port.begin;
+    size_t available = port.end - port.begin;
+    const char* newline = (const char*)memchr(start + scanned, '\n', available - scanned);
+    if(newline) {
+      Value line = vm.copyString(String(start, newline - start));
+      port.begin += newline - start + 1;
+      return line;
+    }
+    scanned = available;
+    if(!port.fill(vm)) {
+      if(available == 0) {
+        return vm.nil;
+      }
+      Value line = vm.copyString(String(port.buffer.data() + port.begin, available));
+      port.begin = port.end;
+      return line;
+    }
+  }
+}
+
+// (read-bytes port count) returns up to count bytes, or () at end of file.
+Value builtin_read_bytes(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2);
+  Port& port = args[0].asPort(vm);
+  int count = args[1].asInteger(vm);
+  VM_EXPECT(vm, count >= 0 && port.input && port.fd >= 0);
+  if(port.begin == port.end && count > 0 && !port.fill(vm)) {
+    return vm.nil;
+  }
+
+  // The bytes are collected outside the heap, which only gets what was
+  // actually read, however many were asked for.
+  std::string data;
+  size_t got = std::min((size_t)count, port.end - port.begin);
+  data.append(port.buffer.data() + port.begin, got);
+  port.begin += got;
+  // The rest is read into the string directly if it wouldn't fit in the
+  // buffer anyway, growing it as the reads succeed.
+  while(data.size() < (size_t)count && !port.eof) {
+    size_t wanted = count - data.size();
+    if(wanted < port.buffer.size()) {
+      if(!port.fill(vm)) {
+        break;
+      }
+      size_t chunk = std::min(wanted, port.end - port.begin);
+      data.append(port.buffer.data() + port.begin, chunk);
+      port.begin += chunk;
+      continue;
+    }
+    size_t start = data.size();
+    data.resize(start + std::min(wanted, std::max(port.buffer.size(), start)));
+    ssize_t read_now = read(port.fd, &data[start], data.size() - start);
+    data.resize(start + std::max(read_now, (ssize_t)0));
+    if(read_now < 0 && errno == EINTR) {
+      continue;
+    }
+    VM_EXPECT(vm, read_now >= 0);
+    if(read_now == 0) {
+      port.eof = true;
+    }
+  }
+  return vm.copyString(String(data.data(), data.size()));
+}
+
+// (write-string port str)
+Value builtin_write_string(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2);
+  Port& port = args[0].asPort(vm);
+  const String& str = args[1].asString(vm);
+  port.write(vm, str.text, str.length);
+  return vm.nil;
+}
+
+Value builtin_flush(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 1);
+  args[0].asPort(vm).flush(vm);
+  return vm.nil;
+}
+
+Value builtin_close_port(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 1);
+  args[0].asPort(vm).close(vm);
+  return vm.nil;
+}
@@ -0,0 +1,53 @@
+#ifndef MYLISP_PORT_H_
+#define MYLISP_PORT_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "value.h"
+
+struct iovec;
+
+// A buffered file descriptor.  Input ports read ahead a buffer at a time;
+// output ports collect writes and hand the buffer and any write that
+// doesn't fit in it to the kernel in a single writev.  Reads and writes
+// larger than the buffer go straight between the file and the string.
+//
+// Ports are owned by the root VM, which flushes and closes them when it is
+// destroyed.  They aren't locked, so two actors shouldn't use one at once.
+class Port {
+public:
+  int fd;
+  const bool input;
+  const bool owned;
+  bool eof = false;
+  std::vector<char> buffer;
+
+  // Input: the unread bytes are [begin, end).  Output: [0, end) is waiting
+  // to be written.
+  size_t begin = 0;
+  size_t end = 0;
+
+  Port* next = 0;
+
+  Port(int fd, bool input, bool owned, size_t bufferSize);
+  ~Port();
+
+  // Reads more input after the unread bytes, growing the buffer if it is
+  // full.  Returns false at end of file.
+  bool fill(VM& vm);
+
+  void write(VM& vm, const char* data, size_t length);
+  void flush(VM& vm);
+  void close(VM& vm);
+
+private:
+  bool writeAll(iovec* iov, int count);
+};
+
+const size_t defaultPortBufferSize = 64 * 1024;
+
+Value make_port(VM& vm, Port* port);
+
+#endif
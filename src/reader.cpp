@@ -0,0 +1,145 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "reader.h"
+#include "optimize.h"
+#include "vm.h"
+
+MappedFile::MappedFile(const char* path) {
+  int fd = open(path, O_RDONLY);
+  if(fd < 0) {
+    return;
+  }
+  struct stat st;
+  if(fstat(fd, &st) == 0) {
+    if(st.st_size == 0) {
+      data = "";
+    } else {
+      void* mapped = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if(mapped != MAP_FAILED) {
+        madvise(mapped, st.st_size, MADV_SEQUENTIAL);
+        data = (const char*)mapped;
+        length = st.st_size;
+      }
+    }
+  }
+  close(fd);
+}
+
+MappedFile::~MappedFile() {
+  if(length > 0) {
+    munmap((void*)data, length);
+  }
+}
+
+static bool is_space(char ch) {
+  return ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r';
+}
+
+void FormReader::skipSpace() {
+  while(pos < end) {
+    if(*pos == ';') {
+      while(pos < end && *pos != '\n') {
+        pos++;
+      }
+    } else if(is_space(*pos)) {
+      pos++;
+    } else {
+      return;
+    }
+  }
+}
+
+void FormReader::skipString() {
+  for(pos++; pos < end && *pos != '"'; pos++) {
+    if(*pos == '\\' && pos + 1 < end) {
+      pos++;
+    }
+  }
+  if(pos < end) {
+    pos++;
+  }
+}
+
+void FormReader::skipAtom() {
+  while(pos < end && !is_space(*pos) && *pos != '(' && *pos != ')' && *pos != '"' && *pos != ';') {
+    pos++;
+  }
+}
+
+bool FormReader::next(String& form) {
+  skipSpace();
+  if(pos == end) {
+    return false;
+  }
+  const char* start = pos;
+  size_t depth = 0;
+  while(pos < end) {
+    if(depth > 0) {
+      skipSpace();
+      if(pos == end) {
+        break;
+      }
+    }
+    if(*pos == '(') {
+      depth++;
+      pos++;
+    } else if(*pos == ')') {
+      pos++;
+      if(depth > 0) {
+        depth--;
+      }
+    } else if(*pos == '"') {
+      skipString();
+    } else if(*pos == '\'') {
+      // The quoted form follows.
+      pos++;
+      skipSpace();
+      continue;
+    } else {
+      skipAtom();
+    }
+    if(depth == 0) {
+      break;
+    }
+  }
+  form = String(start, pos - start);
+  return true;
+}
+
+static void run_form(VM& vm, const String& text, bool optimize_code) {
+  Value form = vm.parse(text);
+  Value program = vm.transform(form);
+  Value result;
+  if(form.isCons() && form.asConsUnsafe().first == vm.makeSymbol("module")) {
+    if(optimize_code) {
+      program = optimize(vm, program);
+    }
+    Value module = eval(vm, vm.makeList(program, vm.objs.builtin_load_module), vm.nil);
+    Value mainCall = vm.makeList(vm.makeList(module, vm.makeList(vm.syms.quote, vm.syms.main)));
+    result = eval(vm, mainCall, vm.nil);
+  } else {
+    result = eval(vm, program, vm.nil);
+  }
+  vm.print(result);
+  fflush(stdout);
+}
+
+void run_stream(VM& vm, const String& source, bool optimize_code) {
+  vm.loadBootModules();
+  FormReader reader(source);
+  String text;
+  while(reader.next(text)) {
+    // Hash-consed cells are interned in a table owned by the root VM, so
+    // they can't live in a heap that is dropped.
+    if(vm.hashConsing) {
+      run_form(vm, text, optimize_code);
+    } else {
+      VM scratch(vm);
+      run_form(scratch, text, optimize_code);
+    }
+  }
+}
@@ -0,0 +1,48 @@
+#ifndef MYLISP_READER_H_
+#define MYLISP_READER_H_
+
+#include <stddef.h>
+
+#include "value.h"
+
+// A file mapped read-only into memory.  data is 0 if it couldn't be
+// mapped; an empty file maps to an empty string.
+class MappedFile {
+public:
+  const char* data = 0;
+  size_t length = 0;
+
+  MappedFile(const char* path);
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+};
+
+// Splits source text into top-level forms without parsing them, following
+// the lexical rules of lang/parse: strings, comments, quotes and atoms.  A
+// form left open at the end of the text is returned as is, for the parser
+// to report.
+class FormReader {
+public:
+  FormReader(const String& source): pos(source.text), end(source.text + source.length) {}
+
+  bool next(String& form);
+
+private:
+  const char* pos;
+  const char* end;
+
+  void skipSpace();
+  void skipString();
+  void skipAtom();
+};
+
+// Reads the forms of source one at a time, transforming and evaluating
+// each before reading the next and printing its value.  Modules are run
+// like `mylisp file` runs them.  Unless hash consing is on, every form gets
+// a scratch VM that is dropped once its value is printed, so memory use
+// follows the largest form rather than the whole file.
+void run_stream(VM& vm, const String& source, bool optimize_code);
+
+#endif
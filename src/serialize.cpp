@@ -1,8 +1,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <vector>
+
 #include "serialize.h"
 #include "vm.h"
+#include "vector.h"
+#include "hashmap.h"
+#include "array.h"
 
 StringBuffer::StringBuffer():
   bufCapacity(10),
@@ -68,16 +73,26 @@ int readInt(const char*& data) {
   }
 }
 
-int builtin_id(Value value) {
-  return 0;
-}
-
-Value builtin_with_id(VM& vm, int id) {
-  return 0;
+// Builtins are serialized by name and resolved against the core imports of
+// the VM that loads them.
+Value builtin_with_name(VM& vm, const String& name) {
+  if(name == String(builtin_name(vm.objs.builtin_load_module))) {
+    return vm.objs.builtin_load_module;
+  }
+  Value found = vm.nil;
+  hashmap_for_each(vm.core_imports, [&name, &found](Value key, Value builtin) {
+    if(name == String(builtin_name(builtin))) {
+      found = builtin;
+    }
+  });
+  if(found.isNil()) {
+    VM_ERROR(vm, "unknown builtin");
+  }
+  return found;
 }
 
 void serializeTo(StringBuffer& buf, Value value) {
-  switch(value->type) {
+  switch(value->type()) {
   case Object::Type::Nil:
     buf.append(SerializedData::NIL);
     return;
@@ -103,10 +118,12 @@ void serializeTo(StringBuffer& buf, Value value) {
     writeInt(buf, data.length);
     buf.append(data);
   } return;
-  case Object::Type::Builtin:
+  case Object::Type::Builtin: {
     buf.append(SerializedData::BUILTIN);
-    writeInt(buf, builtin_id(value));
-    return;
+    String name(builtin_name(value));
+    writeInt(buf, name.length);
+    buf.append(name);
+  } return;
   case Object::Type::Bool:
     buf.append(value.asBoolUnsafe() ? SerializedData::BOOL_TRUE : SerializedData::BOOL_FALSE);
     return;
@@ -116,6 +133,28 @@ void serializeTo(StringBuffer& buf, Value value) {
     serializeTo(buf, value->as_lambda.params);
     serializeTo(buf, value->as_lambda.body);
     return;
+  case Object::Type::Vector: {
+    buf.append(SerializedData::VECTOR);
+    const Vector& v = value.asVectorUnsafe();
+    writeInt(buf, v.length);
+    for(size_t i = 0; i < v.length; i++) {
+      serializeTo(buf, vector_get(v, i));
+    }
+  } return;
+  case Object::Type::HashMap:
+    buf.append(SerializedData::HASHMAP);
+    writeInt(buf, value.asHashMapUnsafe().count);
+    hashmap_for_each(value, [&buf](Value key, Value item) {
+      serializeTo(buf, key);
+      serializeTo(buf, item);
+    });
+    return;
+  case Object::Type::Array: {
+    buf.append(SerializedData::ARRAY);
+    const Array& a = value.asArrayUnsafe();
+    writeInt(buf, a.length);
+    buf.append(String((const char*)a.data, sizeof(int64_t) * a.length));
+  } return;
   default:
     EXPECT(0);
     return;
@@ -129,25 +168,26 @@ String serialize(Value value) {
 }
 
 Value deserializeFrom(VM& vm, const char*& data) {
-  static int depth = 0;
   char ch = *(data++);
   switch(ch) {
   case SerializedData::NIL:
     return vm.nil;
   case SerializedData::CONS: {
-    depth++;
-    Value first = deserializeFrom(vm, data);
-    Value rest = deserializeFrom(vm, data);
-    depth--;
-    return vm.makeCons(first, rest);
+    // The spine is read in a loop, and the list laid out in one run.
+    std::vector<Value> items;
+    items.push_back(deserializeFrom(vm, data));
+    while(*data == SerializedData::CONS) {
+      data++;
+      items.push_back(deserializeFrom(vm, data));
+    }
+    Value tail = deserializeFrom(vm, data);
+    return vm.makeContiguousList(items.data(), items.size(), tail);
   } break;
   case SerializedData::STRING: {
     int len = readInt(data);
-    char* buf = (char*) malloc(len + 1);
-    memcpy(buf, data, len);
-    buf[len] = 0;
+    Value str = vm.copyString(String(data, len));
     data += len;
-    return vm.makeString(String(buf, len));
+    return str;
   } break;
   case SerializedData::INTEGER: {
     int res = readInt(data);
@@ -155,15 +195,15 @@ Value deserializeFrom(VM& vm, const char*& data) {
   } break;
   case SerializedData::SYMBOL: {
     int len = readInt(data);
-    char* buf = (char*) malloc(len + 1);
-    memcpy(buf, data, len);
-    buf[len] = 0;
+    String name(data, len);
     data += len;
-    return vm.makeSymbol(buf);
+    return vm.makeSymbol(name);
   } break;
   case SerializedData::BUILTIN: {
-    int id = readInt(data);
-    return builtin_with_id(vm, id);
+    int len = readInt(data);
+    String name(data, len);
+    data += len;
+    return builtin_with_name(vm, name);
   } break;
   case SerializedData::BOOL_TRUE:
     return vm.true_;
@@ -175,6 +215,31 @@ Value deserializeFrom(VM& vm, const char*& data) {
     Value body = deserializeFrom(vm, data);
     return make_lambda(vm, params, body, env);
   } break;
+  case SerializedData::VECTOR: {
+    int len = readInt(data);
+    std::vector<Value> items;
+    for(int i = 0; i < len; i++) {
+      items.push_back(deserializeFrom(vm, data));
+    }
+    return make_vector(vm, items.data(), items.size());
+  } break;
+  case SerializedData::HASHMAP: {
+    int count = readInt(data);
+    Value map = make_hashmap(vm);
+    for(int i = 0; i < count; i++) {
+      Value key = deserializeFrom(vm, data);
+      Value item = deserializeFrom(vm, data);
+      map = hashmap_assoc(vm, map, key, item);
+    }
+    return map;
+  } break;
+  case SerializedData::ARRAY: {
+    int length = readInt(data);
+    Value array = make_array(vm, length);
+    memcpy(array.asArrayUnsafe().data, data, sizeof(int64_t) * length);
+    data += sizeof(int64_t) * length;
+    return array;
+  } break;
   }
   EXPECT(0);
   return 0;
@@ -14,6 +14,9 @@ public:
     BOOL_TRUE,
     BOOL_FALSE,
     LAMBDA,
+    VECTOR,
+    HASHMAP,
+    ARRAY,
   };
 };
 
@@ -47,3 +50,5 @@ String serialize(Value value);
 Value deserializeFrom(VM& vm, const char*& data);
 
 Value deserialize(VM& vm, const char* data);
+
+Value builtin_with_name(VM& vm, const String& name);
@@ -0,0 +1,204 @@
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/prctl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "server.h"
+#include "optimize.h"
+#include "vm.h"
+
+static const char requestSucceeded[] = {0, 0};
+
+static bool socket_address(const char* path, sockaddr_un& addr) {
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if(strlen(path) >= sizeof(addr.sun_path)) {
+    fprintf(stderr, "socket path too long: %s\n", path);
+    return false;
+  }
+  strcpy(addr.sun_path, path);
+  return true;
+}
+
+static bool write_all(int fd, const char* data, size_t length) {
+  while(length > 0) {
+    ssize_t written = send(fd, data, length, MSG_NOSIGNAL);
+    if(written < 0) {
+      if(errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data += written;
+    length -= written;
+  }
+  return true;
+}
+
+static void read_all(int fd, std::string& out) {
+  char buf[4096];
+  while(true) {
+    ssize_t got = read(fd, buf, sizeof(buf));
+    if(got < 0 && errno == EINTR) {
+      continue;
+    } else if(got <= 0) {
+      return;
+    }
+    out.append(buf, got);
+  }
+}
+
+static void run_request(VM& vm, RequestKind kind, const std::string& text, const ServerOptions& options) {
+  Value program = vm.transform(vm.parse(text.c_str(), false));
+  Value result;
+  if(kind == RequestKind::Script) {
+    if(options.optimize) {
+      program = optimize(vm, program);
+    }
+    Value module = eval(vm, vm.makeList(program, vm.objs.builtin_load_module), vm.nil);
+    Value mainCall = vm.makeList(vm.makeList(module, vm.makeList(vm.syms.quote, vm.syms.main)));
+    result = eval(vm, mainCall, vm.nil);
+  } else {
+    result = eval(vm, program, vm.nil);
+  }
+  vm.print(result);
+}
+
+// Runs in a worker process, with stdout and stderr pointed at the client
+// until the request is done.  A request that fails gets the error instead
+// of the status, which is how the client learns it failed.
+static void handle_connection(VM& vm, int client, const ServerOptions& options) {
+  std::string request;
+  read_all(client, request);
+  if(request.empty() || (request[0] != (char)RequestKind::Script && request[0] != (char)RequestKind::Expression)) {
+    close(client);
+    return;
+  }
+
+  int savedStdout = dup(STDOUT_FILENO);
+  int savedStderr = dup(STDERR_FILENO);
+  dup2(client, STDOUT_FILENO);
+  dup2(client, STDERR_FILENO);
+  bool succeeded = true;
+  try {
+    run_request(vm, (RequestKind)request[0], request.substr(1), options);
+    vm.flushPorts();
+  } catch(const VMError& error) {
+    succeeded = false;
+    try {
+      vm.flushPorts();
+    } catch(const VMError&) {}
+    fflush(stdout);
+    error.print(stderr);
+  }
+  fflush(stdout);
+  fflush(stderr);
+  if(succeeded) {
+    write_all(client, requestSucceeded, sizeof(requestSucceeded));
+  }
+  dup2(savedStdout, STDOUT_FILENO);
+  dup2(savedStderr, STDERR_FILENO);
+  close(savedStdout);
+  close(savedStderr);
+  close(client);
+  // Resetting would wait for actors the request left behind, which may be
+  // blocked in receive for good.  The worker is replaced instead.
+  if(vm.actorsRunning()) {
+    exit(0);
+  }
+  vm.reset();
+}
+
+static pid_t spawn_worker(VM& vm, int listener, const ServerOptions& options) {
+  fflush(stdout);
+  fflush(stderr);
+  pid_t pid = fork();
+  if(pid != 0) {
+    return pid;
+  }
+  prctl(PR_SET_PDEATHSIG, SIGTERM);
+  for(size_t served = 0; served < options.requestsPerWorker; served++) {
+    int client;
+    do {
+      client = accept(listener, 0, 0);
+    } while(client < 0 && errno == EINTR);
+    if(client < 0) {
+      break;
+    }
+    handle_connection(vm, client, options);
+  }
+  exit(0);
+}
+
+int serve(VM& vm, const char* path, const ServerOptions& options) {
+  // The socket is bound under a temporary name and renamed once it is
+  // listening, so a client that sees the path can always connect.
+  std::string bound = std::string(path) + ".new";
+  sockaddr_un addr;
+  if(!socket_address(bound.c_str(), addr)) {
+    return 1;
+  }
+  int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  unlink(bound.c_str());
+  if(listener < 0 || bind(listener, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(listener, 64) < 0 ||
+      rename(bound.c_str(), path) < 0) {
+    perror(path);
+    return 1;
+  }
+
+  vm.loadBootModules();
+  vm.checkpoint();
+  for(size_t i = 0; i < options.workers; i++) {
+    spawn_worker(vm, listener, options);
+  }
+  fprintf(stderr, "serving on %s with %zu workers\n", path, options.workers);
+
+  while(true) {
+    int status;
+    pid_t pid = wait(&status);
+    if(pid < 0) {
+      if(errno == EINTR) {
+        continue;
+      }
+      perror("wait");
+      return 1;
+    }
+    spawn_worker(vm, listener, options);
+  }
+}
+
+bool server_request(const char* path, RequestKind kind, const String& text, std::string& output) {
+  sockaddr_un addr;
+  if(!socket_address(path, addr)) {
+    return false;
+  }
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if(fd < 0 || connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+    perror(path);
+    if(fd >= 0) {
+      close(fd);
+    }
+    return false;
+  }
+
+  char header = (char)kind;
+  bool sent = write_all(fd, &header, 1) && write_all(fd, text.text, text.length);
+  shutdown(fd, SHUT_WR);
+  output.clear();
+  read_all(fd, output);
+  close(fd);
+
+  size_t length = sizeof(requestSucceeded);
+  bool succeeded = sent && output.size() >= length &&
+    memcmp(output.data() + output.size() - length, requestSucceeded, length) == 0;
+  if(succeeded) {
+    output.resize(output.size() - length);
+  }
+  return succeeded;
+}
@@ -0,0 +1,44 @@
+#ifndef MYLISP_SERVER_H_
+#define MYLISP_SERVER_H_
+
+#include <stddef.h>
+
+#include <string>
+
+#include "value.h"
+
+// mylisp --serve listens on a Unix domain socket with a VM whose boot
+// modules are already loaded.  A pool of worker processes is forked from
+// it; each accepts connections one at a time, runs the request in its copy
+// of the warm VM, writes what it printed back and resets the VM to how it
+// was forked.  A worker exits after requestsPerWorker requests, or after a
+// request that leaves actors running, and the server forks a replacement.
+//
+// A request is one kind byte followed by the source text, ended by
+// shutting down the write side.  The response is everything the request
+// printed to stdout or stderr, followed by a 0 byte and a status byte if
+// the request succeeded.
+enum class RequestKind : char {
+  // A module, run like `mylisp file` runs one.
+  Script = 's',
+  // A single form, transformed and evaluated.
+  Expression = 'e',
+};
+
+class ServerOptions {
+public:
+  size_t workers = 4;
+  bool optimize = true;
+
+  // Bounds what a worker can leak outside its VM, such as symbols.
+  size_t requestsPerWorker = 1000;
+};
+
+// Only returns if the socket can't be set up.
+int serve(VM& vm, const char* path, const ServerOptions& options);
+
+// Sends a request and collects the response.  Returns false if the request
+// failed or the server couldn't be reached.
+bool server_request(const char* path, RequestKind kind, const String& text, std::string& output);
+
+#endif
@@ -17,6 +17,11 @@ SYM(Symbol, "Symbol")
 SYM(Builtin, "Builtin")
 SYM(Bool, "Bool")
 SYM(Lambda, "Lambda")
+SYM(Vector, "Vector")
+SYM(HashMap, "HashMap")
+SYM(Array, "Array")
+SYM(Memoized, "Memoized")
+SYM(Port, "Port")
 SYM(first, "first")
 SYM(rest, "rest")
 SYM(is_equal, "eq?")
@@ -25,3 +30,64 @@ SYM(split, "split")
 SYM(ctor, "ctor")
 SYM(symbol_name, "sym-name")
 SYM(make_symbol, "make-sym")
+SYM(pmap, "pmap")
+SYM(pfilter, "pfilter")
+SYM(preduce, "preduce")
+SYM(spawn, "spawn")
+SYM(send, "send")
+SYM(receive, "receive")
+SYM(self, "self")
+SYM(freeze, "freeze")
+SYM(vector, "vector")
+SYM(vector_ref, "vector-ref")
+SYM(vector_set, "vector-set")
+SYM(vector_push, "vector-push")
+SYM(vector_append, "vector-append")
+SYM(vector_slice, "vector-slice")
+SYM(vector_length, "vector-length")
+SYM(vector_to_list, "vector-to-list")
+SYM(list_to_vector, "list-to-vector")
+SYM(hash_map, "hash-map")
+SYM(hash_get, "hash-get")
+SYM(hash_has, "hash-has?")
+SYM(hash_assoc, "hash-assoc")
+SYM(hash_dissoc, "hash-dissoc")
+SYM(hash_count, "hash-count")
+SYM(hash_keys, "hash-keys")
+SYM(hash_to_list, "hash-to-list")
+SYM(hash, "hash")
+SYM(array, "array")
+SYM(list_to_array, "list-to-array")
+SYM(array_to_list, "array-to-list")
+SYM(array_range, "array-range")
+SYM(array_length, "array-length")
+SYM(array_ref, "array-ref")
+SYM(array_add, "array-add")
+SYM(array_mul, "array-mul")
+SYM(array_less, "array-less")
+SYM(array_sum, "array-sum")
+SYM(array_dot, "array-dot")
+SYM(array_min, "array-min")
+SYM(array_max, "array-max")
+SYM(string_length, "string-length")
+SYM(char_at, "char-at")
+SYM(char_code, "char-code")
+SYM(substring, "substring")
+SYM(string_index_of, "string-index-of")
+SYM(string_span, "string-span")
+SYM(string_escape, "string-escape")
+SYM(string_to_int, "string-to-int")
+SYM(int_to_string, "int-to-string")
+SYM(hash_cons_stats, "hash-cons-stats")
+SYM(memoize, "memoize")
+SYM(memo_stats, "memo-stats")
+SYM(macroexpand, "macroexpand")
+SYM(open_input_file, "open-input-file")
+SYM(open_output_file, "open-output-file")
+SYM(standard_output_port, "standard-output-port")
+SYM(read_line, "read-line")
+SYM(read_bytes, "read-bytes")
+SYM(write_string, "write-string")
+SYM(flush, "flush")
+SYM(close_port, "close-port")
+SYM(heap_stats, "heap-stats")
@@ -0,0 +1,293 @@
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <new>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "text.h"
+#include "builtin.h"
+#include "bind.h"
+
+static const size_t simdWidth = 16;
+
+size_t text_find_byte(const String& str, size_t start, char ch) {
+  size_t i = start;
+#if defined(__SSE2__)
+  __m128i pattern = _mm_set1_epi8(ch);
+  for(; i + simdWidth <= str.length; i += simdWidth) {
+    __m128i data = _mm_loadu_si128((const __m128i*)(str.text + i));
+    int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(data, pattern));
+    if(mask) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+#endif
+  for(; i < str.length; i++) {
+    if(str.text[i] == ch) {
+      return i;
+    }
+  }
+  return str.length;
+}
+
+size_t text_find(const String& str, size_t start, const String& needle) {
+  if(needle.length == 0) {
+    return start;
+  }
+  size_t i = start;
+  while(i + needle.length <= str.length) {
+    i = text_find_byte(str, i, needle.text[0]);
+    if(i + needle.length > str.length) {
+      break;
+    }
+    if(memcmp(str.text + i, needle.text, needle.length) == 0) {
+      return i;
+    }
+    i++;
+  }
+  return str.length;
+}
+
+static size_t scalar_scan(const String& str, size_t start, const String& set, bool inSet) {
+  bool table[256];
+  memset(table, 0, sizeof(table));
+  for(size_t i = 0; i < set.length; i++) {
+    table[(unsigned char)set.text[i]] = true;
+  }
+  for(size_t i = start; i < str.length; i++) {
+    if(table[(unsigned char)str.text[i]] != inSet) {
+      return i;
+    }
+  }
+  return str.length;
+}
+
+#if defined(__x86_64__)
+
+#define SSE42 __attribute__((target("sse4.2")))
+
+// pcmpestri compares each byte of a chunk against a set of up to 16 bytes,
+// which covers the character classes the reader and printer care about.
+static SSE42 size_t sse42_scan(const String& str, size_t start, const String& set, bool inSet) {
+  char padded[simdWidth];
+  memset(padded, 0, sizeof(padded));
+  memcpy(padded, set.text, set.length);
+  __m128i needles = _mm_loadu_si128((const __m128i*)padded);
+  int n = (int)set.length;
+
+  size_t i = start;
+  for(; i + simdWidth <= str.length; i += simdWidth) {
+    __m128i data = _mm_loadu_si128((const __m128i*)(str.text + i));
+    int index = inSet
+      ? _mm_cmpestri(needles, n, data, simdWidth, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_NEGATIVE_POLARITY)
+      : _mm_cmpestri(needles, n, data, simdWidth, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY);
+    if(index < (int)simdWidth) {
+      return i + index;
+    }
+  }
+  return scalar_scan(str, i, set, inSet);
+}
+
+static bool has_sse42() {
+  static const bool supported = __builtin_cpu_supports("sse4.2");
+  return supported;
+}
+
+static size_t scan(const String& str, size_t start, const String& set, bool inSet) {
+  if(set.length > 0 && set.length <= simdWidth && has_sse42()) {
+    return sse42_scan(str, start, set, inSet);
+  }
+  return scalar_scan(str, start, set, inSet);
+}
+
+#else
+
+static size_t scan(const String& str, size_t start, const String& set, bool inSet) {
+  return scalar_scan(str, start, set, inSet);
+}
+
+#endif
+
+size_t text_span(const String& str, size_t start, const String& set) {
+  return scan(str, start, set, true);
+}
+
+size_t text_break(const String& str, size_t start, const String& set) {
+  return scan(str, start, set, false);
+}
+
+static char* copy_parts(char* out, const String* parts, size_t count) {
+  for(size_t i = 0; i < count; i++) {
+    memcpy(out, parts[i].text, parts[i].length);
+    out += parts[i].length;
+  }
+  return out;
+}
+
+String text_concat(VM& vm, const String* parts, size_t count) {
+  if(count == 0) {
+    return String("", 0);
+  }
+  size_t total = 0;
+  for(size_t i = 0; i < count; i++) {
+    total += parts[i].length;
+  }
+  const String& first = parts[0];
+  if(total == first.length) {
+    return first;
+  }
+
+  StringChunk* chunk = first.chunk;
+  if(chunk) {
+    size_t end = first.text + first.length - chunk->data();
+    size_t expected = end;
+    if(chunk->capacity - end >= total - first.length &&
+        chunk->used.compare_exchange_strong(expected, end + total - first.length)) {
+      copy_parts(chunk->data() + end, parts + 1, count - 1);
+      return String(first.text, total, chunk);
+    }
+  }
+
+  size_t capacity = chunk ? total * 2 : total;
+  StringChunk* fresh = ::new(vm.alloc(sizeof(StringChunk) + capacity)) StringChunk();
+  fresh->used = total;
+  fresh->capacity = capacity;
+  copy_parts(fresh->data(), parts, count);
+  return String(fresh->data(), total, fresh);
+}
+
+static size_t string_index(VM& vm, const String& str, Value index) {
+  int i = index.asInteger(vm);
+  VM_EXPECT(vm, i >= 0 && (size_t)i <= str.length);
+  return i;
+}
+
+// Optional trailing start index shared by the scanning builtins.
+static size_t optional_start(VM& vm, const String& str, const Value* args, size_t n, size_t i) {
+  VM_EXPECT(vm, n == i || n == i + 1);
+  return n == i ? 0 : string_index(vm, str, args[i]);
+}
+
+Value builtin_string_length(VM& vm, const Value* args, size_t n) {
+  return vm.makeInteger(singleValue(vm, args, n).asString(vm).length);
+}
+
+static String char_at(VM& vm, String str, size_t i) {
+  VM_EXPECT(vm, i < str.length);
+  return str.substr(i, 1);
+}
+
+Value builtin_char_at(VM& vm, const Value* args, size_t n) {
+  return BIND_BUILTIN(char_at)(vm, args, n);
+}
+
+static int char_code(VM& vm, String str, size_t i) {
+  VM_EXPECT(vm, i < str.length);
+  return (unsigned char)str.text[i];
+}
+
+Value builtin_char_code(VM& vm, const Value* args, size_t n) {
+  return BIND_BUILTIN(char_code)(vm, args, n);
+}
+
+// (substring s begin [end]) shares the bytes of `s`.
+Value builtin_substring(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2 || n == 3);
+  String str = args[0].asString(vm);
+  size_t begin = string_index(vm, str, args[1]);
+  size_t end = n == 3 ? string_index(vm, str, args[2]) : str.length;
+  VM_EXPECT(vm, begin <= end);
+  return vm.makeString(str.substr(begin, end - begin));
+}
+
+// (string-index-of s needle [start]) is () when `needle` doesn't occur.
+Value builtin_string_index_of(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n >= 2);
+  String str = args[0].asString(vm);
+  String needle = args[1].asString(vm);
+  size_t start = optional_start(vm, str, args, n, 2);
+  size_t found = text_find(str, start, needle);
+  if(found + needle.length > str.length) {
+    return vm.nil;
+  }
+  return vm.makeInteger(found);
+}
+
+// (string-span s chars [start]) is the index of the first byte that isn't one
+// of `chars`, or the length of `s`.
+Value builtin_string_span(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n >= 2);
+  String str = args[0].asString(vm);
+  String set = args[1].asString(vm);
+  return vm.makeInteger(text_span(str, optional_start(vm, str, args, n, 2), set));
+}
+
+static String escape_sequence(char ch) {
+  switch(ch) {
+  case '\n': return String("\\n");
+  case '"':  return String("\\\"");
+  default:   return String("\\\\");
+  }
+}
+
+Value builtin_string_escape(VM& vm, const Value* args, size_t n) {
+  Value value = singleValue(vm, args, n);
+  String str = value.asString(vm);
+  String special("\"\\\n");
+  size_t i = text_break(str, 0, special);
+  if(i == str.length) {
+    return value;
+  }
+
+  size_t escapes = 0;
+  for(size_t j = i; j < str.length; j = text_break(str, j + 1, special)) {
+    escapes++;
+  }
+
+  Value escaped = vm.allocString(str.length + escapes);
+  char* out = (char*)escaped.asStringUnsafe().text;
+  size_t done = 0;
+  while(i < str.length) {
+    memcpy(out, str.text + done, i - done);
+    out += i - done;
+    String sequence = escape_sequence(str.text[i]);
+    memcpy(out, sequence.text, sequence.length);
+    out += sequence.length;
+    done = i + 1;
+    i = text_break(str, done, special);
+  }
+  memcpy(out, str.text + done, str.length - done);
+  return escaped;
+}
+
+// (string-to-int s) is () unless `s` is an optionally negative run of digits.
+Value builtin_string_to_int(VM& vm, const Value* args, size_t n) {
+  String str = singleValue(vm, args, n).asString(vm);
+  size_t i = 0;
+  bool negative = str.length > 0 && str.text[0] == '-';
+  if(negative) {
+    i++;
+  }
+  size_t end = text_span(str, i, String("0123456789"));
+  if(end == i || end != str.length) {
+    return vm.nil;
+  }
+  long long value = 0;
+  for(; i < end; i++) {
+    value = value * 10 + (str.text[i] - '0');
+    VM_EXPECT(vm, value <= (long long)INT_MAX + 1);
+  }
+  value = negative ? -value : value;
+  VM_EXPECT(vm, value >= INT_MIN && value <= INT_MAX);
+  return vm.makeInteger((int)value);
+}
+
+Value builtin_int_to_string(VM& vm, const Value* args, size_t n) {
+  char digits[16];
+  int length = snprintf(digits, sizeof(digits), "%d", singleValue(vm, args, n).asInteger(vm));
+  return vm.copyString(String(digits, length));
+}
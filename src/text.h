@@ -0,0 +1,39 @@
+#ifndef MYLISP_TEXT_H_
+#define MYLISP_TEXT_H_
+
+#include <stddef.h>
+
+#include <atomic>
+
+#include "value.h"
+
+class StringChunk {
+public:
+  std::atomic<size_t> used;
+  size_t capacity;
+
+  inline char* data() { return (char*)(this + 1); }
+};
+
+// Concatenates `parts`.  When the first part ends its chunk and the chunk has
+// room, the rest are appended in place, so accumulating a string one piece
+// at a time is linear.  Otherwise the result gets a fresh chunk, with room to
+// grow if the first part was itself built by concatenation.
+String text_concat(VM& vm, const String* parts, size_t count);
+
+// Byte-oriented scanning over strings.  Each returns an index into `str`, or
+// `str.length` when the scan runs off the end.
+
+// Index of the first occurrence of `ch` at or after `start`.
+size_t text_find_byte(const String& str, size_t start, char ch);
+
+// Index of the first occurrence of `needle` at or after `start`.
+size_t text_find(const String& str, size_t start, const String& needle);
+
+// Index of the first byte at or after `start` that is not in `set`.
+size_t text_span(const String& str, size_t start, const String& set);
+
+// Index of the first byte at or after `start` that is in `set`.
+size_t text_break(const String& str, size_t start, const String& set);
+
+#endif
@@ -1,7 +1,11 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <vector>
+
 #include "vm.h"
+#include "vector.h"
+#include "hashmap.h"
 
 String::String(const char* value): String(value, strlen(value)) {}
 
@@ -15,8 +19,41 @@ bool String::operator == (const String& other) const {
     memcmp(text, other.text, length) == 0;
 }
 
-void* Object::operator new (size_t size, VM& vm) {
-  return vm.alloc(size);
+void* Object::operator new (size_t size, VM& vm, Type type, size_t extra) {
+  return vm.allocObject(type, extra);
+}
+
+size_t object_size(Object::Type type) {
+  switch(type) {
+  case Object::Type::Nil:
+    return sizeof(void*);
+  case Object::Type::Cons:
+    return 2 * sizeof(Value);
+  case Object::Type::String:
+  case Object::Type::Symbol:
+    return sizeof(String);
+  case Object::Type::Integer:
+    return sizeof(int);
+  case Object::Type::Builtin:
+    return sizeof(Object::as_builtin);
+  case Object::Type::Bool:
+    return sizeof(bool);
+  case Object::Type::Lambda:
+    return sizeof(Lambda);
+  case Object::Type::Vector:
+    return sizeof(Vector);
+  case Object::Type::HashMap:
+    return sizeof(HashMap);
+  case Object::Type::Array:
+    return sizeof(Array);
+  case Object::Type::Memoized:
+    return sizeof(Memoized);
+  case Object::Type::Compiled:
+    return sizeof(Compiled);
+  case Object::Type::Port:
+    return sizeof(Port*);
+  }
+  return sizeof(Object);
 }
 
 Cons& Value::asCons(VM& vm) const {
@@ -49,6 +86,31 @@ Lambda& Value::asLambda(VM& vm) const {
   return asLambdaUnsafe();
 }
 
+Vector& Value::asVector(VM& vm) const {
+  VM_EXPECT(vm, isVector());
+  return asVectorUnsafe();
+}
+
+HashMap& Value::asHashMap(VM& vm) const {
+  VM_EXPECT(vm, isHashMap());
+  return asHashMapUnsafe();
+}
+
+Array& Value::asArray(VM& vm) const {
+  VM_EXPECT(vm, isArray());
+  return asArrayUnsafe();
+}
+
+Memoized& Value::asMemoized(VM& vm) const {
+  VM_EXPECT(vm, isMemoized());
+  return asMemoizedUnsafe();
+}
+
+Port& Value::asPort(VM& vm) const {
+  VM_EXPECT(vm, isPort());
+  return asPortUnsafe();
+}
+
 
 Value cons_first(VM& vm, Value o) {
   VM_EXPECT(vm, o.isCons());
@@ -81,17 +143,18 @@ const char* builtin_name(Value o) {
 }
 
 Value make_builtin(VM& vm, const char* name, BuiltinFunc func) {
-  Value o = new(vm) Object(Object::Type::Builtin);
+  Value o = new(vm, Object::Type::Builtin) Object;
   o->as_builtin.name = name;
   o->as_builtin.func = func;
   return o;
 }
 
 Value make_lambda(VM& vm, Value params, Value body, Value env) {
-  Value o = new(vm) Object(Object::Type::Lambda);
+  Value o = new(vm, Object::Type::Lambda) Object;
   o->as_lambda.params = params;
   o->as_lambda.body = body;
   o->as_lambda.env = env;
+  o->as_lambda.frameEscapes = true;
   return o;
 }
 
@@ -99,14 +162,17 @@ bool Value::operator == (const Value& other) const {
   if(obj == other.obj) {
     return true;
   }
-  if(obj->type != other.obj->type) {
+  if(obj->type() != other.obj->type()) {
     return false;
   }
-  switch(obj->type) {
+  switch(obj->type()) {
   case Object::Type::Nil:
     ASSERT(other.isNil() == (obj == other.obj));
     return other.isNil();
   case Object::Type::Cons: {
+    if(obj->hashConsed() && other.obj->hashConsed()) {
+      return false;
+    }
     Cons ca = asConsUnsafe();
     Cons cb = other.asConsUnsafe();
     return ca.first == cb.first && ca.rest == cb.rest;
@@ -115,12 +181,47 @@ bool Value::operator == (const Value& other) const {
     return asStringUnsafe() == other.asStringUnsafe();
   case Object::Type::Integer:
     return asIntegerUnsafe() == other.asIntegerUnsafe();
+  case Object::Type::Vector: {
+    const Vector& va = asVectorUnsafe();
+    const Vector& vb = other.asVectorUnsafe();
+    if(va.length != vb.length) {
+      return false;
+    }
+    for(size_t i = 0; i < va.length; i++) {
+      if(vector_get(va, i) != vector_get(vb, i)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  case Object::Type::HashMap: {
+    if(asHashMapUnsafe().count != other.asHashMapUnsafe().count) {
+      return false;
+    }
+    bool equal = true;
+    Value b = other;
+    hashmap_for_each(*this, [&](Value key, Value value) {
+      Value found;
+      if(equal && !(hashmap_find(b, key, found) && found == value)) {
+        equal = false;
+      }
+    });
+    return equal;
+  }
+  case Object::Type::Array: {
+    const Array& a = asArrayUnsafe();
+    const Array& b = other.asArrayUnsafe();
+    return a.length == b.length && memcmp(a.data, b.data, sizeof(int64_t) * a.length) == 0;
+  }
   case Object::Type::Bool:
     ASSERT( (obj == other.obj) == (asBoolUnsafe() == other.asBoolUnsafe()) );
     // fallthrough
   case Object::Type::Symbol:
   case Object::Type::Builtin:
   case Object::Type::Lambda:
+  case Object::Type::Memoized:
+  case Object::Type::Compiled:
+  case Object::Type::Port:
     return obj == other.obj;
   default:
     EXPECT(0);
@@ -128,6 +229,89 @@ bool Value::operator == (const Value& other) const {
   }
 }
 
+static uint32_t hash_mix(uint32_t h) {
+  h ^= h >> 16;
+  h *= 0x85ebca6b;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35;
+  h ^= h >> 16;
+  return h;
+}
+
+static uint32_t hash_bytes(const char* data, size_t length, uint32_t h) {
+  for(size_t i = 0; i < length; i++) {
+    h = (h ^ (uint8_t)data[i]) * 16777619;
+  }
+  return h;
+}
+
+static uint32_t hash_combine(uint32_t seed, uint32_t h) {
+  return seed ^ (h + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+// Consistent with operator ==: values that compare by identity hash their
+// address, everything else hashes its contents.
+static const uint32_t consSeed = (uint32_t)Object::Type::Cons * 0x9e3779b9;
+
+uint32_t cons_hash(Value first, Value rest) {
+  return hash_combine(hash_combine(consSeed, value_hash(first)), value_hash(rest));
+}
+
+uint32_t value_hash(Value value) {
+  if(value.isCons() && value->hashConsed()) {
+    return value->as_cons.hash;
+  }
+  uint32_t h = (uint32_t)value->type() * 0x9e3779b9;
+  switch(value->type()) {
+  case Object::Type::Nil:
+    return h;
+  case Object::Type::Cons: {
+    // Hashes are built from the end of the list, so that the hash of a
+    // hash-consed tail can be used as is.
+    std::vector<Object*> spine;
+    while(value.isCons() && !value->hashConsed()) {
+      spine.push_back(value.getObj());
+      value = value->as_cons.rest;
+    }
+    h = value_hash(value);
+    for(size_t i = spine.size(); i > 0; i--) {
+      h = hash_combine(hash_combine(consSeed, value_hash(spine[i - 1]->as_cons.first)), h);
+    }
+    return h;
+  }
+  case Object::Type::String: {
+    const String& str = value.asStringUnsafe();
+    return hash_combine(h, hash_bytes(str.text, str.length, 2166136261u));
+  }
+  case Object::Type::Integer:
+    return hash_combine(h, hash_mix((uint32_t)value.asIntegerUnsafe()));
+  case Object::Type::Symbol: {
+    const String& str = value.asSymbolUnsafe();
+    return hash_combine(h, hash_bytes(str.text, str.length, 2166136261u));
+  }
+  case Object::Type::Vector: {
+    const Vector& v = value.asVectorUnsafe();
+    for(size_t i = 0; i < v.length; i++) {
+      h = hash_combine(h, value_hash(vector_get(v, i)));
+    }
+    return h;
+  }
+  case Object::Type::HashMap: {
+    uint32_t sum = 0;
+    hashmap_for_each(value, [&sum](Value key, Value item) {
+      sum += hash_combine(value_hash(key), value_hash(item));
+    });
+    return hash_combine(h, sum);
+  }
+  case Object::Type::Array: {
+    const Array& a = value.asArrayUnsafe();
+    return hash_combine(h, hash_bytes((const char*)a.data, sizeof(int64_t) * a.length, 2166136261u));
+  }
+  default:
+    return hash_combine(h, hash_mix((uint32_t)(uintptr_t)value.getObj() ^ (uint32_t)((uintptr_t)value.getObj() >> 32)));
+  }
+}
+
 Value map_lookup(VM& vm, Map map, Value key) {
   return map_lookup_or_else(vm, map, key, [&vm](Value key)->Value {
     VM_ERROR(vm, "lookup failed");
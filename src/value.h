@@ -2,21 +2,33 @@
 #define MYLISP_VALUE_H_
 
 #include <stddef.h>
+#include <stdint.h>
 
 class VM;
 
 class Value;
 
-typedef Value (*BuiltinFunc)(VM& vm, Value args);
+typedef Value (*BuiltinFunc)(VM& vm, const Value* args, size_t n);
+
+// Code generated by --compile-c: `self` is the closure being called.
+typedef Value (*CompiledFunc)(VM& vm, Value self, const Value* args, size_t n);
 
 class Object;
 
+class StringChunk;
+
 class String {
 public:
   const char* text;
   size_t length;
 
-  inline String(const char* text, size_t length): text(text), length(length) {}
+  // The buffer this string was built in by concat, if any.  A later concat
+  // can append in place when the string still ends the buffer's used part.
+  StringChunk* chunk;
+
+  inline String(): text(""), length(0), chunk(0) {}
+  inline String(const char* text, size_t length, StringChunk* chunk = 0):
+    text(text), length(length), chunk(chunk) {}
   String(const char* text);
 
   inline String substr(size_t begin, size_t length) const {
@@ -28,6 +40,12 @@ public:
 
 class Cons;
 class Lambda;
+class Vector;
+class HashMap;
+class Array;
+class Memoized;
+class Port;
+class Compiled;
 
 class Value {
 private:
@@ -50,6 +68,12 @@ public:
   inline bool isBuiltin() const;
   inline bool isBool() const;
   inline bool isLambda() const;
+  inline bool isVector() const;
+  inline bool isHashMap() const;
+  inline bool isArray() const;
+  inline bool isMemoized() const;
+  inline bool isPort() const;
+  inline bool isCompiled() const;
 
   inline Cons& asConsUnsafe() const;
   inline String& asStringUnsafe() const;
@@ -57,6 +81,12 @@ public:
   inline bool& asBoolUnsafe() const;
   inline int& asIntegerUnsafe() const;
   inline Lambda& asLambdaUnsafe() const;
+  inline Vector& asVectorUnsafe() const;
+  inline HashMap& asHashMapUnsafe() const;
+  inline Array& asArrayUnsafe() const;
+  inline Memoized& asMemoizedUnsafe() const;
+  inline Compiled& asCompiledUnsafe() const;
+  inline Port& asPortUnsafe() const;
 
   Cons& asCons(VM& vm) const;
   String& asString(VM& vm) const;
@@ -64,6 +94,11 @@ public:
   bool& asBool(VM& vm) const;
   int& asInteger(VM& vm) const;
   Lambda& asLambda(VM& vm) const;
+  Vector& asVector(VM& vm) const;
+  HashMap& asHashMap(VM& vm) const;
+  Array& asArray(VM& vm) const;
+  Memoized& asMemoized(VM& vm) const;
+  Port& asPort(VM& vm) const;
 
   operator bool () const = delete;
 };
@@ -72,6 +107,9 @@ class Cons {
 public:
   Value first;
   Value rest;
+
+  // Structural hash, only set on hash-consed cells.
+  uint32_t hash;
 };
 
 class Lambda {
@@ -79,10 +117,58 @@ public:
   Value params;
   Value body;
   Value env;
+
+  // Clear when escape analysis showed that nothing in `body` can hold on to
+  // the environment of a call, so calls can bind their arguments in scratch
+  // storage.
+  bool frameEscapes;
+};
+
+class VectorNode;
+
+class Vector {
+public:
+  size_t length;
+  unsigned shift;
+  VectorNode* root;
+};
+
+class HashNode;
+
+class HashMap {
+public:
+  size_t count;
+  HashNode* root;
+};
+
+class Array {
+public:
+  size_t length;
+  int64_t* data;
+};
+
+class MemoCache;
+
+class Memoized {
+public:
+  Value func;
+  MemoCache* cache;
+};
+
+// A closure of compiled code.  `captured` holds the values of the variables
+// it refers to, in an order only the generated code knows; `constants` are
+// the quoted values of the module it came from.
+class Compiled {
+public:
+  CompiledFunc func;
+  const char* name;
+  Value* captured;
+  const Value* constants;
 };
 
 class Object {
 public:
+  // Port must stay last; see objectKinds.
   enum class Type {
     Nil,
     Cons,
@@ -91,11 +177,17 @@ public:
     Symbol,
     Builtin,
     Bool,
-    Lambda
+    Lambda,
+    Vector,
+    HashMap,
+    Array,
+    Memoized,
+    Compiled,
+    Port
   };
 
-  Type type;
-
+  // Objects carry no tag: each one is only as big as its member, and its
+  // type is kept in the header of the page it was allocated in.
   union {
     Cons as_cons;
     String as_string;
@@ -107,21 +199,74 @@ public:
     } as_builtin;
     bool as_bool;
     Lambda as_lambda;
+    Vector as_vector;
+    HashMap as_hashmap;
+    Array as_array;
+    Memoized as_memoized;
+    Compiled as_compiled;
+    Port* as_port;
   };
 
-  Object(Type type): type(type) {}
+  Object() {}
+
+  inline Type type() const;
+
+  // Set on cons cells interned by the hash-cons table.  Two such cells are
+  // structurally equal only if they are the same cell.
+  inline bool hashConsed() const;
+
+  // `extra` bytes follow the object, for strings and symbols that keep
+  // their text inline.
+  inline void* operator new (size_t size, VM& vm, Type type, size_t extra = 0);
+};
+
+// Objects live in pages of pageSize bytes, aligned to their size, that each
+// hold a single type of object, so an object's type is found by masking
+// its address.  Objects too big for a page start a run of pages of their
+// own.
+const uintptr_t pageSize = 4096;
 
-  inline void* operator new (size_t size, VM& vm);
+class PageHeader {
+public:
+  Object::Type type;
+
+  // Pages of cells interned by the hash-cons table, which carry their hash.
+  bool hashConsed;
 };
 
-bool Value::isNil() const { return obj->type == Object::Type::Nil; }
-bool Value::isCons() const { return obj->type == Object::Type::Cons; }
-bool Value::isString() const { return obj->type == Object::Type::String; }
-bool Value::isInteger() const { return obj->type == Object::Type::Integer; }
-bool Value::isSymbol() const { return obj->type == Object::Type::Symbol; }
-bool Value::isBuiltin() const { return obj->type == Object::Type::Builtin; }
-bool Value::isBool() const { return obj->type == Object::Type::Bool; }
-bool Value::isLambda() const { return obj->type == Object::Type::Lambda; }
+// Pages start with their header; objects follow it.
+const size_t pageHeaderSize = (sizeof(PageHeader) + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+
+inline const PageHeader& page_header(const void* p) {
+  return *(const PageHeader*)((uintptr_t)p & ~(pageSize - 1));
+}
+
+// A macro rather than a call to page_header, since type checks are the
+// hottest code in the VM and it is built without optimization.
+#define PAGE_TYPE(p) (((const PageHeader*)((uintptr_t)(p) & ~(pageSize - 1)))->type)
+
+Object::Type Object::type() const { return PAGE_TYPE(this); }
+
+bool Object::hashConsed() const { return page_header(this).hashConsed; }
+
+// What an object of `type` takes, not counting inline text.  Conses leave
+// out the hash, which only hash-consed cells have.
+size_t object_size(Object::Type type);
+
+bool Value::isNil() const { return PAGE_TYPE(obj) == Object::Type::Nil; }
+bool Value::isCons() const { return PAGE_TYPE(obj) == Object::Type::Cons; }
+bool Value::isString() const { return PAGE_TYPE(obj) == Object::Type::String; }
+bool Value::isInteger() const { return PAGE_TYPE(obj) == Object::Type::Integer; }
+bool Value::isSymbol() const { return PAGE_TYPE(obj) == Object::Type::Symbol; }
+bool Value::isBuiltin() const { return PAGE_TYPE(obj) == Object::Type::Builtin; }
+bool Value::isBool() const { return PAGE_TYPE(obj) == Object::Type::Bool; }
+bool Value::isLambda() const { return PAGE_TYPE(obj) == Object::Type::Lambda; }
+bool Value::isVector() const { return PAGE_TYPE(obj) == Object::Type::Vector; }
+bool Value::isHashMap() const { return PAGE_TYPE(obj) == Object::Type::HashMap; }
+bool Value::isArray() const { return PAGE_TYPE(obj) == Object::Type::Array; }
+bool Value::isMemoized() const { return PAGE_TYPE(obj) == Object::Type::Memoized; }
+bool Value::isPort() const { return PAGE_TYPE(obj) == Object::Type::Port; }
+bool Value::isCompiled() const { return PAGE_TYPE(obj) == Object::Type::Compiled; }
 
 Cons& Value::asConsUnsafe() const { return obj->as_cons; }
 String& Value::asStringUnsafe() const { return obj->as_string; }
@@ -129,6 +274,12 @@ String& Value::asSymbolUnsafe() const { return obj->as_symbol; }
 bool& Value::asBoolUnsafe() const { return obj->as_bool; }
 int& Value::asIntegerUnsafe() const { return obj->as_integer; }
 Lambda& Value::asLambdaUnsafe() const { return obj->as_lambda; }
+Vector& Value::asVectorUnsafe() const { return obj->as_vector; }
+HashMap& Value::asHashMapUnsafe() const { return obj->as_hashmap; }
+Array& Value::asArrayUnsafe() const { return obj->as_array; }
+Memoized& Value::asMemoizedUnsafe() const { return obj->as_memoized; }
+Compiled& Value::asCompiledUnsafe() const { return obj->as_compiled; }
+Port& Value::asPortUnsafe() const { return *obj->as_port; }
 
 Value make_builtin(VM& vm, const char* name, BuiltinFunc func);
 
@@ -148,8 +299,23 @@ Value make_lambda(VM& vm, Value params, Value body, Value env);
 
 typedef Value Map;
 
+uint32_t value_hash(Value value);
+
+// The hash value_hash gives a cons of `first` and `rest`.
+uint32_t cons_hash(Value first, Value rest);
+
+bool hashmap_find(Value map, Value key, Value& result);
+
+// Maps are either association lists or hash maps.
 template<class Func>
 Value map_lookup_or_else(VM& vm, Map map, Value key, Func func) {
+  if(map.isHashMap()) {
+    Value result;
+    if(hashmap_find(map, key, result)) {
+      return result;
+    }
+    return func(key);
+  }
   Value p = map;
   while(!p.isNil()) {
     Cons c = p.asCons(vm);
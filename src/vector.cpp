@@ -0,0 +1,182 @@
+#include <string.h>
+
+#include <vector>
+
+#include "vector.h"
+#include "builtin.h"
+#include "vm.h"
+
+static VectorNode* make_node(VM& vm) {
+  VectorNode* node = (VectorNode*)vm.alloc(sizeof(VectorNode));
+  memset(node, 0, sizeof(VectorNode));
+  return node;
+}
+
+static Value make_vector_object(VM& vm, size_t length, unsigned shift, VectorNode* root) {
+  Value o = new(vm, Object::Type::Vector) Object;
+  Vector& v = o.asVectorUnsafe();
+  v.length = length;
+  v.shift = shift;
+  v.root = root;
+  return o;
+}
+
+Value make_vector(VM& vm, const Value* items, size_t length) {
+  if(length == 0) {
+    return make_vector_object(vm, 0, 0, 0);
+  }
+
+  std::vector<VectorNode*> level;
+  for(size_t i = 0; i < length; i += vectorBranching) {
+    VectorNode* leaf = make_node(vm);
+    for(size_t j = 0; j < vectorBranching && i + j < length; j++) {
+      Value item = items[i + j];
+      leaf->slots[j] = item.getObj();
+    }
+    level.push_back(leaf);
+  }
+
+  unsigned shift = 0;
+  while(level.size() > 1) {
+    std::vector<VectorNode*> parents;
+    for(size_t i = 0; i < level.size(); i += vectorBranching) {
+      VectorNode* parent = make_node(vm);
+      for(size_t j = 0; j < vectorBranching && i + j < level.size(); j++) {
+        parent->slots[j] = level[i + j];
+      }
+      parents.push_back(parent);
+    }
+    level.swap(parents);
+    shift += vectorBits;
+  }
+
+  return make_vector_object(vm, length, shift, level[0]);
+}
+
+static VectorNode* set_path(VM& vm, VectorNode* node, unsigned level, size_t index, Value item) {
+  VectorNode* copy = make_node(vm);
+  if(node) {
+    memcpy(copy->slots, node->slots, sizeof(copy->slots));
+  }
+  if(level == 0) {
+    copy->slots[index & vectorMask] = item.getObj();
+  } else {
+    size_t slot = (index >> level) & vectorMask;
+    copy->slots[slot] = set_path(vm, (VectorNode*)copy->slots[slot], level - vectorBits, index, item);
+  }
+  return copy;
+}
+
+Value vector_set(VM& vm, Value vector, size_t index, Value item) {
+  const Vector& v = vector.asVector(vm);
+  if(index >= v.length) {
+    VM_ERROR(vm, "vector index out of bounds");
+  }
+  return make_vector_object(vm, v.length, v.shift, set_path(vm, v.root, v.shift, index, item));
+}
+
+Value vector_push(VM& vm, Value vector, Value item) {
+  const Vector& v = vector.asVector(vm);
+  VectorNode* root = v.root;
+  unsigned shift = v.shift;
+  if(root && v.length == (size_t)1 << (shift + vectorBits)) {
+    VectorNode* grown = make_node(vm);
+    grown->slots[0] = root;
+    root = grown;
+    shift += vectorBits;
+  }
+  return make_vector_object(vm, v.length + 1, shift, set_path(vm, root, shift, v.length, item));
+}
+
+Value vector_from_list(VM& vm, Value list) {
+  std::vector<Value> items;
+  while(!list.isNil()) {
+    Cons c = list.asCons(vm);
+    items.push_back(c.first);
+    list = c.rest;
+  }
+  return make_vector(vm, items.data(), items.size());
+}
+
+Value vector_to_list(VM& vm, Value vector) {
+  const Vector& v = vector.asVector(vm);
+  Value list = vm.nil;
+  for(size_t i = v.length; i > 0; i--) {
+    list = vm.makeCons(vector_get(v, i - 1), list);
+  }
+  return list;
+}
+
+static size_t vector_index(VM& vm, Value index, size_t limit) {
+  int i = index.asInteger(vm);
+  if(i < 0 || (size_t)i > limit) {
+    VM_ERROR(vm, "vector index out of bounds");
+  }
+  return i;
+}
+
+Value builtin_vector(VM& vm, const Value* args, size_t n) {
+  return make_vector(vm, args, n);
+}
+
+Value builtin_vector_ref(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2);
+  const Vector& v = args[0].asVector(vm);
+  if(v.length == 0) {
+    VM_ERROR(vm, "vector index out of bounds");
+  }
+  return vector_get(v, vector_index(vm, args[1], v.length - 1));
+}
+
+Value builtin_vector_set(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 3);
+  int index = args[1].asInteger(vm);
+  VM_EXPECT(vm, index >= 0);
+  return vector_set(vm, args[0], index, args[2]);
+}
+
+Value builtin_vector_push(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 2);
+  return vector_push(vm, args[0], args[1]);
+}
+
+// Shares the left operand's trie and copies only the paths the appended
+// items land on.
+Value builtin_vector_append(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n >= 1);
+  Value result = args[0];
+  result.asVector(vm);
+  for(size_t j = 1; j < n; j++) {
+    const Vector& v = args[j].asVector(vm);
+    for(size_t i = 0; i < v.length; i++) {
+      result = vector_push(vm, result, vector_get(v, i));
+    }
+  }
+  return result;
+}
+
+Value builtin_vector_slice(VM& vm, const Value* args, size_t n) {
+  VM_EXPECT(vm, n == 3);
+  const Vector& v = args[0].asVector(vm);
+  size_t begin = vector_index(vm, args[1], v.length);
+  size_t end = vector_index(vm, args[2], v.length);
+  VM_EXPECT(vm, begin <= end);
+
+  std::vector<Value> items;
+  for(size_t i = begin; i < end; i++) {
+    items.push_back(vector_get(v, i));
+  }
+  return make_vector(vm, items.data(), items.size());
+}
+
+Value builtin_vector_length(VM& vm, const Value* args, size_t n) {
+  return vm.makeInteger(singleValue(vm, args, n).asVector(vm).length);
+}
+
+Value builtin_vector_to_list(VM& vm, const Value* args, size_t n) {
+  return vector_to_list(vm, singleValue(vm, args, n));
+}
+
+Value builtin_list_to_vector(VM& vm, const Value* args, size_t n) {
+  return vector_from_list(vm, singleValue(vm, args, n));
+}
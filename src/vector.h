@@ -0,0 +1,38 @@
+#ifndef MYLISP_VECTOR_H_
+#define MYLISP_VECTOR_H_
+
+#include <stddef.h>
+
+#include "value.h"
+
+// Persistent vectors are radix tries with 32-way branching: leaves hold the
+// items, inner nodes hold child nodes, and updates copy only the path from
+// the root to the changed leaf.
+const unsigned vectorBits = 5;
+const size_t vectorBranching = 1 << vectorBits;
+const size_t vectorMask = vectorBranching - 1;
+
+class VectorNode {
+public:
+  void* slots[vectorBranching];
+};
+
+inline Value vector_get(const Vector& vector, size_t index) {
+  VectorNode* node = vector.root;
+  for(unsigned level = vector.shift; level > 0; level -= vectorBits) {
+    node = (VectorNode*)node->slots[(index >> level) & vectorMask];
+  }
+  return (Object*)node->slots[index & vectorMask];
+}
+
+Value make_vector(VM& vm, const Value* items, size_t length);
+
+Value vector_set(VM& vm, Value vector, size_t index, Value item);
+
+Value vector_push(VM& vm, Value vector, Value item);
+
+Value vector_from_list(VM& vm, Value list);
+
+Value vector_to_list(VM& vm, Value vector);
+
+#endif
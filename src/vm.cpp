@@ -3,53 +3,52 @@
 #include <stdio.h>
 #include <stdio.h>
 #include <string.h>
+#include <unistd.h>
 #include <stdarg.h>
 
+#include <algorithm>
+#include <new>
+#include <vector>
+
 #include "vm.h"
 #include "builtin.h"
 #include "serialize.h"
+#include "parallel.h"
+#include "actor.h"
+#include "hashmap.h"
+#include "hashcons.h"
+#include "memo.h"
+#include "port.h"
+#include "native.h"
+#include "compiled.h"
 
 void _assert_failed(const char* file, int line, const char* message, ...) {
-  fprintf(stderr, "assertion failure, %s:%d:\n  ", file, line);
-
+  char text[1024];
   va_list ap;
   va_start(ap, message);
-  vfprintf(stderr, message, ap);
+  vsnprintf(text, sizeof(text), message, ap);
   va_end(ap);
 
-  fprintf(stderr, "\n");
-
-  exit(1);
+  VMError error(file, line, text);
+  error.assertion = true;
+  throw error;
 }
 
-struct heap_block_t {
-  heap_block_t* next;
-  size_t capacity;
-  size_t used;
-  uint8_t* data;
-};
+void VMError::print(FILE* f) const {
+  if(assertion) {
+    fprintf(f, "assertion failure, %s:%d:\n  %s\n", file, line, message.c_str());
+  } else {
+    fprintf(f, "error occurred: %s:%d: %s\n", file, line, message.c_str());
+  }
+  for(const std::string& frame : trace) {
+    fwrite(frame.data(), 1, frame.size(), f);
+  }
+}
 
 size_t max_sizet(size_t a, size_t b) {
   return a > b ? a : b;
 }
 
-heap_block_t* make_heap_block(size_t size, heap_block_t* next) {
-  uint8_t* data = (uint8_t*) malloc(size);
-  heap_block_t* h = (heap_block_t*)(void*)data;
-  h->next = next;
-  h->capacity = size - sizeof(heap_block_t);
-  h->used = 0;
-  h->data = data + sizeof(heap_block_t);
-  return h;
-}
-
-void free_heap_block(heap_block_t* h) {
-  if(h->next) {
-    free_heap_block(h->next);
-  }
-  free(h);
-}
-
 Syms::Syms(VM& vm):
 #define SYM(cpp, lisp) cpp(vm.makeSymbol(lisp)),
 #include "symbols.inc.h"
@@ -58,16 +57,19 @@ Syms::Syms(VM& vm):
 
 VM::VM(size_t heap_block_size):
   heap_block_size(heap_block_size),
-  heap(make_heap_block(heap_block_size, 0)),
-  nil(new(*this) Object(Object::Type::Nil)),
-  true_(new (*this) Object(Object::Type::Bool)),
-  false_(new (*this) Object(Object::Type::Bool)),
+  heap(heap_block_size),
+  symbolHeap(heap_block_size),
+  scratch(0),
+  root(this),
+  nil(new(*this, Object::Type::Nil) Object),
+  true_(new(*this, Object::Type::Bool) Object),
+  false_(new(*this, Object::Type::Bool) Object),
   symList(nil),
   syms(*this)
 {
   VM& vm = *this;
 
-  loaded_modules = nil;
+  scratch = newBlock(heap_block_size, 0);
 
   true_->as_bool = true;
   false_->as_bool = false;
@@ -76,7 +78,7 @@ VM::VM(size_t heap_block_size):
   objs.builtin_cons = make_builtin(vm, "cons", builtin_cons);
   objs.builtin_load_module = make_builtin(vm, "load-module", builtin_load_module);
 
-  vm.core_imports = makeList(
+  vm.core_imports = hashmap_from_alist(vm, makeList(
     makeCons(syms.add, objs.builtin_add),
     makeCons(syms.sub, make_builtin(vm, "sub", builtin_sub)),
     makeCons(syms.mul, make_builtin(vm, "mul", builtin_mul)),
@@ -90,38 +92,547 @@ VM::VM(size_t heap_block_size):
     makeCons(syms.split, make_builtin(vm, "split", builtin_split)),
     makeCons(syms.ctor, make_builtin(vm, "constructor", builtin_constructor)),
     makeCons(syms.make_symbol, make_builtin(vm, "make-symbol", builtin_make_symbol)),
-    makeCons(syms.symbol_name, make_builtin(vm, "symbol-name", builtin_symbol_name)));
+    makeCons(syms.symbol_name, make_builtin(vm, "symbol-name", builtin_symbol_name)),
+    makeCons(syms.pmap, make_builtin(vm, "pmap", builtin_pmap)),
+    makeCons(syms.pfilter, make_builtin(vm, "pfilter", builtin_pfilter)),
+    makeCons(syms.preduce, make_builtin(vm, "preduce", builtin_preduce)),
+    makeCons(syms.spawn, make_builtin(vm, "spawn", builtin_spawn)),
+    makeCons(syms.send, make_builtin(vm, "send", builtin_send)),
+    makeCons(syms.receive, make_builtin(vm, "receive", builtin_receive)),
+    makeCons(syms.self, make_builtin(vm, "self", builtin_self)),
+    makeCons(syms.freeze, make_builtin(vm, "freeze", builtin_freeze)),
+    makeCons(syms.vector, make_builtin(vm, "vector", builtin_vector)),
+    makeCons(syms.vector_ref, make_builtin(vm, "vector-ref", builtin_vector_ref)),
+    makeCons(syms.vector_set, make_builtin(vm, "vector-set", builtin_vector_set)),
+    makeCons(syms.vector_push, make_builtin(vm, "vector-push", builtin_vector_push)),
+    makeCons(syms.vector_append, make_builtin(vm, "vector-append", builtin_vector_append)),
+    makeCons(syms.vector_slice, make_builtin(vm, "vector-slice", builtin_vector_slice)),
+    makeCons(syms.vector_length, make_builtin(vm, "vector-length", builtin_vector_length)),
+    makeCons(syms.vector_to_list, make_builtin(vm, "vector-to-list", builtin_vector_to_list)),
+    makeCons(syms.list_to_vector, make_builtin(vm, "list-to-vector", builtin_list_to_vector)),
+    makeCons(syms.hash_map, make_builtin(vm, "hash-map", builtin_hash_map)),
+    makeCons(syms.hash_get, make_builtin(vm, "hash-get", builtin_hash_get)),
+    makeCons(syms.hash_has, make_builtin(vm, "hash-has?", builtin_hash_has)),
+    makeCons(syms.hash_assoc, make_builtin(vm, "hash-assoc", builtin_hash_assoc)),
+    makeCons(syms.hash_dissoc, make_builtin(vm, "hash-dissoc", builtin_hash_dissoc)),
+    makeCons(syms.hash_count, make_builtin(vm, "hash-count", builtin_hash_count)),
+    makeCons(syms.hash_keys, make_builtin(vm, "hash-keys", builtin_hash_keys)),
+    makeCons(syms.hash_to_list, make_builtin(vm, "hash-to-list", builtin_hash_to_list)),
+    makeCons(syms.hash, make_builtin(vm, "hash", builtin_hash)),
+    makeCons(syms.array, make_builtin(vm, "array", builtin_array)),
+    makeCons(syms.list_to_array, make_builtin(vm, "list-to-array", builtin_list_to_array)),
+    makeCons(syms.array_to_list, make_builtin(vm, "array-to-list", builtin_array_to_list)),
+    makeCons(syms.array_range, make_builtin(vm, "array-range", builtin_array_range)),
+    makeCons(syms.array_length, make_builtin(vm, "array-length", builtin_array_length)),
+    makeCons(syms.array_ref, make_builtin(vm, "array-ref", builtin_array_ref)),
+    makeCons(syms.array_add, make_builtin(vm, "array-add", builtin_array_add)),
+    makeCons(syms.array_mul, make_builtin(vm, "array-mul", builtin_array_mul)),
+    makeCons(syms.array_less, make_builtin(vm, "array-less", builtin_array_less)),
+    makeCons(syms.array_sum, make_builtin(vm, "array-sum", builtin_array_sum)),
+    makeCons(syms.array_dot, make_builtin(vm, "array-dot", builtin_array_dot)),
+    makeCons(syms.array_min, make_builtin(vm, "array-min", builtin_array_min)),
+    makeCons(syms.array_max, make_builtin(vm, "array-max", builtin_array_max)),
+    makeCons(syms.string_length, make_builtin(vm, "string-length", builtin_string_length)),
+    makeCons(syms.char_at, make_builtin(vm, "char-at", builtin_char_at)),
+    makeCons(syms.char_code, make_builtin(vm, "char-code", builtin_char_code)),
+    makeCons(syms.substring, make_builtin(vm, "substring", builtin_substring)),
+    makeCons(syms.string_index_of, make_builtin(vm, "string-index-of", builtin_string_index_of)),
+    makeCons(syms.string_span, make_builtin(vm, "string-span", builtin_string_span)),
+    makeCons(syms.string_escape, make_builtin(vm, "string-escape", builtin_string_escape)),
+    makeCons(syms.string_to_int, make_builtin(vm, "string-to-int", builtin_string_to_int)),
+    makeCons(syms.int_to_string, make_builtin(vm, "int-to-string", builtin_int_to_string)),
+    makeCons(syms.hash_cons_stats, make_builtin(vm, "hash-cons-stats", builtin_hash_cons_stats)),
+    makeCons(syms.memoize, make_builtin(vm, "memoize", builtin_memoize)),
+    makeCons(syms.memo_stats, make_builtin(vm, "memo-stats", builtin_memo_stats)),
+    makeCons(syms.macroexpand, make_builtin(vm, "macroexpand", builtin_macroexpand)),
+    makeCons(syms.open_input_file, make_builtin(vm, "open-input-file", builtin_open_input_file)),
+    makeCons(syms.open_output_file, make_builtin(vm, "open-output-file", builtin_open_output_file)),
+    makeCons(syms.standard_output_port, make_builtin(vm, "standard-output-port", builtin_standard_output_port)),
+    makeCons(syms.read_line, make_builtin(vm, "read-line", builtin_read_line)),
+    makeCons(syms.read_bytes, make_builtin(vm, "read-bytes", builtin_read_bytes)),
+    makeCons(syms.write_string, make_builtin(vm, "write-string", builtin_write_string)),
+    makeCons(syms.flush, make_builtin(vm, "flush", builtin_flush)),
+    makeCons(syms.close_port, make_builtin(vm, "close-port", builtin_close_port)),
+    makeCons(syms.heap_stats, make_builtin(vm, "heap-stats", builtin_heap_stats))));
 
-  loaded_modules = makeCons(
-    makeCons(syms.core, make_builtin(vm, "load-from-core", builtin_load_from_core)),
-    loaded_modules);
+  loaded_modules = hashmap_assoc(vm, make_hashmap(vm),
+    syms.core, make_builtin(vm, "load-from-core", builtin_load_from_core));
 
   prettyPrinterImpl = nil;
   transformerImpl = nil;
   parserImpl = nil;
+
+  checkpoint();
+}
+
+VM::VM(VM& parent, size_t heap_block_size):
+  heap_block_size(heap_block_size),
+  heap(heap_block_size),
+  symbolHeap(heap_block_size),
+  scratch(0),
+  root(parent.root),
+  actorId(parent.actorId),
+  hashConsing(parent.hashConsing),
+  jitMode(parent.jitMode),
+  nil(parent.nil),
+  true_(parent.true_),
+  false_(parent.false_),
+  symList(nil),
+  objs(parent.objs),
+  syms(parent.syms),
+  loaded_modules(parent.loaded_modules),
+  core_imports(parent.core_imports),
+  prettyPrinterImpl(parent.prettyPrinterImpl),
+  transformerImpl(parent.transformerImpl),
+  parserImpl(parent.parserImpl)
+{
+  scratch = newBlock(heap_block_size, 0);
 }
 
 VM::~VM() {
-  free_heap_block(heap);
+  if(root == this) {
+    delete actors;
+    delete pool;
+    delete hashConsTable;
+    while(memoCaches) {
+      MemoCache* next = memoCaches->next;
+      delete memoCaches;
+      memoCaches = next;
+    }
+    while(ports) {
+      Port* next = ports->next;
+      delete ports;
+      ports = next;
+    }
+    freeBlocks(symbolHeap.blocks);
+    freeBlocks(frozenHeap);
+    freeBlocks(saved.keptBlocks);
+    delete saved.hashConsTable;
+  }
+  delete jit;
+  freeBlocks(heap.blocks);
+  freeBlocks(scratch);
+  freeBlocks(spareScratch);
 }
 
-void* VM::alloc(size_t size) {
-  if(size > heap->capacity - heap->used) {
-    heap = make_heap_block(max_sizet(heap_block_size, size * 2 + sizeof(heap_block_t)), heap);
+// Set while this thread is in underSharedLock.
+static thread_local bool holdingSharedLock = false;
+
+class BlockFailure {
+public:
+  const char* message;
+};
+
+heap_block_t* VM::newBlock(size_t size, heap_block_t* next) {
+  size_t limit = root->memoryLimit;
+  const char* failure = 0;
+  heap_block_t* block = 0;
+  if(limit && root->reservedBytes + size > limit && !root->limitExceeded.exchange(true)) {
+    failure = "memory limit exceeded";
+  } else if(!(block = make_heap_block(size, next))) {
+    failure = "out of memory";
+  }
+  if(failure) {
+    if(holdingSharedLock) {
+      throw BlockFailure{failure};
+    }
+    VM_ERROR(*this, failure);
+  }
+  root->reservedBytes += heap_block_footprint(block);
+  return block;
+}
+
+template<typename F>
+Value VM::underSharedLock(F f) {
+  const char* failure;
+  {
+    std::lock_guard<std::mutex> guard(root->sharedLock);
+    holdingSharedLock = true;
+    try {
+      Value result = f();
+      holdingSharedLock = false;
+      return result;
+    } catch(const BlockFailure& e) {
+      failure = e.message;
+    }
+    holdingSharedLock = false;
+  }
+  VM_ERROR(*this, failure);
+}
+
+void VM::freeBlocks(heap_block_t* chain) {
+  HeapStats stats;
+  stats.add(chain);
+  root->reservedBytes -= stats.reserved;
+  free_heap_blocks(chain);
+}
+
+// Carves `count` pages out of the current block.  A run of pages that
+// doesn't fit gets a block to itself, linked in behind the current one so
+// the room left in it isn't abandoned.
+uint8_t* VM::takePages(PagedHeap& heap, size_t count) {
+  size_t size = count * pageSize;
+  heap_block_t* block = heap.blocks;
+  if(!block || size > block->capacity - block->used) {
+    if(block && count > 1) {
+      heap_block_t* own = newBlock(size, block->next);
+      own->used = size;
+      block->next = own;
+      return own->data;
+    }
+    heap.blocks = block = newBlock(max_sizet(heap.blockSize, size), block);
+    heap.blockSize = std::min(heap.blockSize * 2, maxHeapBlockSize);
+  }
+  uint8_t* pages = block->data + block->used;
+  block->used += size;
+  return pages;
+}
+
+void* VM::heapAlloc(PagedHeap& heap, size_t kind, Object::Type type, size_t size) {
+  size = (size + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+  uint8_t*& next = heap.next[kind];
+  if(size <= (size_t)(heap.end[kind] - next)) {
+    void* ret = next;
+    next += size;
+    return ret;
+  }
+  size_t count = (pageHeaderSize + size + pageSize - 1) / pageSize;
+  uint8_t* page = takePages(heap, count);
+  uint8_t* ret = init_page(page, type, kind == hashConsedKind);
+  if(count == 1) {
+    next = ret + size;
+    heap.end[kind] = page + pageSize;
   }
-  void* ret = heap->data + heap->used;
-  heap->used += size;
   return ret;
 }
 
+void* VM::alloc(size_t size) {
+  // Raw pages are never asked for a type.
+  return heapAlloc(heap, rawKind, Object::Type::Nil, size);
+}
+
+Object* VM::allocObject(Object::Type type, size_t extra) {
+  return (Object*)heapAlloc(heap, (size_t)type, type, object_size(type) + extra);
+}
+
+Object* VM::allocHashConsedCell() {
+  return (Object*)heapAlloc(heap, hashConsedKind, Object::Type::Cons, sizeof(Cons));
+}
+
+HeapStats VM::heapStats() {
+  HeapStats stats;
+  stats.add(heap.blocks);
+  stats.add(scratch);
+  stats.add(spareScratch);
+  if(root == this) {
+    std::lock_guard<std::mutex> guard(sharedLock);
+    stats.add(symbolHeap.blocks);
+    stats.add(frozenHeap);
+    stats.add(saved.keptBlocks);
+  }
+  return stats;
+}
+
+size_t VM::familyReserved() {
+  return root->reservedBytes;
+}
+
+void VM::setMemoryLimit(size_t bytes) {
+  root->memoryLimit = bytes;
+  root->limitExceeded = false;
+}
+
+void VM::checkpoint() {
+  VM_EXPECT(*this, root == this);
+  std::lock_guard<std::mutex> guard(sharedLock);
+  // The heap's blocks go in front of the ones kept already, and the heap
+  // starts over in a fresh block.
+  heap_block_t* last = heap.blocks;
+  if(last) {
+    while(last->next) {
+      last = last->next;
+    }
+    last->next = saved.keptBlocks;
+    saved.keptBlocks = heap.blocks;
+  }
+  heap.clear();
+  heap.blockSize = heap_block_size;
+  delete saved.hashConsTable;
+  saved.hashConsTable = hashConsTable ? new HashConsTable(*hashConsTable) : 0;
+  saved.frozenHeap = frozenHeap;
+  saved.memoCaches = memoCaches;
+  saved.ports = ports;
+  saved.loadedModules = loaded_modules;
+  saved.prettyPrinterImpl = prettyPrinterImpl;
+  saved.transformerImpl = transformerImpl;
+  saved.parserImpl = parserImpl;
+}
+
+void VM::reset() {
+  VM_EXPECT(*this, root == this && !currentEvalFrame);
+  // Waits for the actors to finish, like the destructor does.
+  delete actors;
+  actors = 0;
+
+  std::lock_guard<std::mutex> guard(sharedLock);
+  // Cells interned before the checkpoint stay interned, so that lists
+  // built again still share them.  Compiled code is rebuilt as it gets
+  // hot.
+  delete hashConsTable;
+  hashConsTable = saved.hashConsTable ? new HashConsTable(*saved.hashConsTable) : 0;
+  delete jit;
+  jit = 0;
+  lambdaInfo.clear();
+
+  while(memoCaches != saved.memoCaches) {
+    MemoCache* next = memoCaches->next;
+    delete memoCaches;
+    memoCaches = next;
+  }
+  for(MemoCache* cache = memoCaches; cache; cache = cache->next) {
+    cache->clear();
+  }
+  while(ports != saved.ports) {
+    Port* next = ports->next;
+    if(ports == stdoutPort) {
+      stdoutPort = 0;
+    }
+    delete ports;
+    ports = next;
+  }
+
+  freeBlocks(heap.blocks);
+  heap.clear();
+  heap.blockSize = heap_block_size;
+  while(frozenHeap != saved.frozenHeap) {
+    heap_block_t* next = frozenHeap->next;
+    frozenHeap->next = 0;
+    freeBlocks(frozenHeap);
+    frozenHeap = next;
+  }
+  while(scratch->next) {
+    heap_block_t* block = scratch;
+    scratch = block->next;
+    block->next = 0;
+    freeBlocks(block);
+  }
+  scratch->used = 0;
+  freeBlocks(spareScratch);
+  spareScratch = 0;
+
+  tailFunc = Value();
+  tailArgs.clear();
+  loaded_modules = saved.loadedModules;
+  prettyPrinterImpl = saved.prettyPrinterImpl;
+  transformerImpl = saved.transformerImpl;
+  parserImpl = saved.parserImpl;
+  suppressInternalRecursion = false;
+  limitExceeded = false;
+}
+
+ScratchMark VM::scratchMark() {
+  return ScratchMark{scratch, scratch->used};
+}
+
+// Blocks filled since the mark are dropped, except that one is kept around
+// so that a loop crossing a block boundary doesn't allocate on every call.
+void VM::scratchRelease(ScratchMark mark) {
+  while(scratch != mark.block) {
+    heap_block_t* block = scratch;
+    scratch = block->next;
+    block->next = 0;
+    if(spareScratch) {
+      freeBlocks(block);
+    } else {
+      spareScratch = block;
+    }
+  }
+  scratch->used = mark.used;
+}
+
+size_t VM::scratchInUse() {
+  size_t used = 0;
+  for(heap_block_t* h = scratch; h; h = h->next) {
+    used += h->used;
+  }
+  return used;
+}
+
+Value VM::makeScratchCons(Value first, Value rest) {
+  const size_t size = object_size(Object::Type::Cons);
+  size_t offset = scratch->used;
+  if(offset % pageSize == 0 || offset % pageSize + size > pageSize) {
+    offset = (offset + pageSize - 1) & ~(pageSize - 1);
+    if(offset + pageHeaderSize + size > scratch->capacity) {
+      if(spareScratch) {
+        spareScratch->next = scratch;
+        scratch = spareScratch;
+        spareScratch = 0;
+      } else {
+        scratch = newBlock(heap_block_size, scratch);
+      }
+      offset = 0;
+    }
+    offset = init_page(scratch->data + offset, Object::Type::Cons) - scratch->data;
+  }
+  scratch->used = offset + size;
+  Value o = ::new(scratch->data + offset) Object;
+  o->as_cons.first = first.getObj();
+  o->as_cons.rest = rest.getObj();
+  return o;
+}
+
+void VM::adoptHeap(VM& other) {
+  heap_block_t* last = other.heap.blocks;
+  if(!last) {
+    return;
+  }
+  while(last->next) {
+    last = last->next;
+  }
+  if(heap.blocks) {
+    last->next = heap.blocks->next;
+    heap.blocks->next = other.heap.blocks;
+  } else {
+    heap.blocks = other.heap.blocks;
+  }
+  other.heap.clear();
+}
+
+void VM::freezeHeap(VM& other) {
+  std::lock_guard<std::mutex> guard(root->sharedLock);
+  heap_block_t* last = other.heap.blocks;
+  if(!last) {
+    return;
+  }
+  while(last->next) {
+    last = last->next;
+  }
+  last->next = root->frozenHeap;
+  root->frozenHeap = other.heap.blocks;
+  other.heap.clear();
+}
+
+bool VM::isFrozen(Value value) {
+  uint8_t* p = (uint8_t*)value.getObj();
+  std::lock_guard<std::mutex> guard(root->sharedLock);
+  for(heap_block_t* h = root->frozenHeap; h; h = h->next) {
+    if(p >= h->data && p < h->data + h->used) {
+      return true;
+    }
+  }
+  return false;
+}
+
+ThreadPool& VM::threadPool() {
+  std::lock_guard<std::mutex> guard(root->sharedLock);
+  if(!root->pool) {
+    root->pool = new ThreadPool(ThreadPool::defaultSize());
+  }
+  return *root->pool;
+}
+
+ActorSystem& VM::actorSystem() {
+  std::lock_guard<std::mutex> guard(root->sharedLock);
+  if(!root->actors) {
+    root->actors = new ActorSystem(*root);
+  }
+  return *root->actors;
+}
+
+bool VM::actorsRunning() {
+  std::lock_guard<std::mutex> guard(root->sharedLock);
+  return root->actors && root->actors->running();
+}
+
 Value VM::makeCons(Value first, Value rest) {
-  Value o = new(*this) Object(Object::Type::Cons);
+  if(hashConsing) {
+    return underSharedLock([&] {
+      if(!root->hashConsTable) {
+        root->hashConsTable = new HashConsTable();
+      }
+      return root->hashConsTable->intern(*this, first, rest);
+    });
+  }
+  return makeFreshCons(first, rest);
+}
+
+Value VM::makeContiguousList(const Value* items, size_t n, Value tail) {
+  if(hashConsing) {
+    Value list = tail;
+    for(size_t i = n; i > 0; i--) {
+      list = makeCons(items[i - 1], list);
+    }
+    return list;
+  }
+  const size_t size = object_size(Object::Type::Cons);
+  const size_t perPage = (pageSize - pageHeaderSize) / size;
+  Value head = tail;
+  Object** link = &head.getObj();
+  while(n > 0) {
+    // A run that doesn't fit in what is left of the current page starts a
+    // new one.
+    size_t count = std::min(n, perPage);
+    uint8_t* cells = (uint8_t*)heapAlloc(heap, (size_t)Object::Type::Cons, Object::Type::Cons, count * size);
+    for(size_t i = 0; i < count; i++) {
+      Object* cell = ::new(cells + i * size) Object;
+      cell->as_cons.first = items[i];
+      cell->as_cons.rest = i + 1 < count ? (Object*)(cells + (i + 1) * size) : tail.getObj();
+    }
+    *link = (Object*)cells;
+    link = &((Object*)(cells + (count - 1) * size))->as_cons.rest.getObj();
+    items += count;
+    n -= count;
+  }
+  return head;
+}
+
+MemoCache* VM::registerMemoCache(MemoCache* cache) {
+  std::lock_guard<std::mutex> guard(root->sharedLock);
+  cache->next = root->memoCaches;
+  root->memoCaches = cache;
+  return cache;
+}
+
+Port* VM::registerPort(Port* port) {
+  std::lock_guard<std::mutex> guard(root->sharedLock);
+  port->next = root->ports;
+  root->ports = port;
+  return port;
+}
+
+Port* VM::standardOutputPort() {
+  if(!root->stdoutPort) {
+    root->stdoutPort = registerPort(new Port(STDOUT_FILENO, false, false, defaultPortBufferSize));
+  }
+  return root->stdoutPort;
+}
+
+void VM::flushPorts() {
+  for(Port* port = root->ports; port; port = port->next) {
+    if(port->fd >= 0) {
+      port->flush(*this);
+    }
+  }
+}
+
+HashConsStats VM::hashConsStats() {
+  std::lock_guard<std::mutex> guard(root->sharedLock);
+  return root->hashConsTable ? root->hashConsTable->stats : HashConsStats();
+}
+
+Value VM::makeFreshCons(Value first, Value rest) {
+  Value o = new(*this, Object::Type::Cons) Object;
   o->as_cons.first = first.getObj();
   o->as_cons.rest = rest.getObj();
   return o;
 }
 
 Value VM::makeSymbol(const String& name) {
+  return underSharedLock([&] { return root->internSymbol(name); });
+}
+
+Value VM::internSymbol(const String& name) {
   Value l = symList;
   while(!l.isNil()) {
     Value first = l->as_cons.first;
@@ -131,20 +642,39 @@ Value VM::makeSymbol(const String& name) {
       return first;
     }
   }
-  Value o = new(*this) Object(Object::Type::Symbol);
-  o.asSymbolUnsafe() = name;
-  symList = makeCons(o, symList);
-  return o;
+  size_t size = object_size(Object::Type::Symbol);
+  char* o = (char*)heapAlloc(symbolHeap, (size_t)Object::Type::Symbol, Object::Type::Symbol, size + name.length);
+  memcpy(o + size, name.text, name.length);
+  Value symbol = ::new(o) Object;
+  symbol->as_symbol = String(o + size, name.length);
+  size = object_size(Object::Type::Cons);
+  Value cell = ::new(heapAlloc(symbolHeap, (size_t)Object::Type::Cons, Object::Type::Cons, size)) Object;
+  cell->as_cons.first = symbol;
+  cell->as_cons.rest = symList;
+  symList = cell;
+  return symbol;
 }
 
 Value VM::makeString(const String& value) {
-  Value o = new(*this) Object(Object::Type::String);
+  Value o = new(*this, Object::Type::String) Object;
   o.asStringUnsafe() = value;
   return o;
 }
 
+Value VM::allocString(size_t length) {
+  Object* o = new(*this, Object::Type::String, length) Object;
+  o->as_string = String((const char*)o + object_size(Object::Type::String), length);
+  return o;
+}
+
+Value VM::copyString(const String& value) {
+  Value o = allocString(value.length);
+  memcpy((char*)o.asStringUnsafe().text, value.text, value.length);
+  return o;
+}
+
 Value VM::makeInteger(int value) {
-  Value o = new(*this) Object(Object::Type::Integer);
+  Value o = new(*this, Object::Type::Integer) Object;
   o.asIntegerUnsafe() = value;
   return o;
 }
@@ -164,28 +694,59 @@ FILE* streamToFile(StandardStream stream) {
   }
 }
 
-void VM::print(Value value, int indent, StandardStream stream) {
-  suppressInternalRecursion = true;
+void VM::loadPrettyPrinter() {
   if(prettyPrinterImpl.isNil()) {
     Value module = loadModule(makeSymbol("lang/prettyprint"));
     prettyPrinterImpl = eval(*this, makeList(module, makeList(syms.quote, makeSymbol("tostring-indented"))), nil);
   }
+}
+
+void VM::loadTransformer() {
+  if(transformerImpl.isNil()) {
+    Value source = deserialize(*this, binary_transform_data);
+    Value module = loadModule(makeSymbol("lang/transform"), source);
+    transformerImpl = eval(*this, makeList(module, makeList(syms.quote, makeSymbol("transform"))), nil);
+  }
+}
+
+void VM::loadParser() {
+  if(parserImpl.isNil()) {
+    Value source = deserialize(*this, binary_parse_data);
+    Value module = loadModule(makeSymbol("lang/parse"), source);
+    parserImpl = eval(*this, makeList(module, makeList(syms.quote, makeSymbol("parse"))), nil);
+  }
+}
+
+void VM::loadBootModules() {
+  suppressInternalRecursion = true;
+  loadParser();
+  loadTransformer();
+  loadPrettyPrinter();
+  suppressInternalRecursion = false;
+}
+
+void VM::print(Value value, int indent, StandardStream stream) {
+  String data = prettyPrint(value, indent);
+  if(root->stdoutPort) {
+    root->stdoutPort->flush(*this);
+  }
   FILE* s = streamToFile(stream);
-  Value quoted_input = makeList(syms.quote, value);
-  Value str = eval(*this, makeList(prettyPrinterImpl, quoted_input, makeInteger(indent)), nil);
-  const String& data = str.asString(*this);
   fwrite(data.text, 1, data.length, s);
   fprintf(s, "\n");
+}
+
+String VM::prettyPrint(Value value, int indent) {
+  suppressInternalRecursion = true;
+  loadPrettyPrinter();
+  Value quoted_input = makeList(syms.quote, value);
+  Value str = eval(*this, makeList(prettyPrinterImpl, quoted_input, makeInteger(indent)), nil);
   suppressInternalRecursion = false;
+  return str.asString(*this);
 }
 
 Value VM::transform(Value input) {
   suppressInternalRecursion = true;
-  if(transformerImpl.isNil()) {
-    Value source = deserialize(*this, binary_transform_data);
-    Value module = loadModule(makeSymbol("lang/transform"), source);
-    transformerImpl = eval(*this, makeList(module, makeList(syms.quote, makeSymbol("transform"))), nil);
-  }
+  loadTransformer();
   Value quoted_input = makeList(syms.quote, input);
   Value transformed = eval(*this, makeList(transformerImpl, quoted_input), nil);
   suppressInternalRecursion = false;
@@ -193,16 +754,30 @@ Value VM::transform(Value input) {
 }
 
 Value VM::parse(const char* text, bool multiexpr) {
-  suppressInternalRecursion = true;
-  if(parserImpl.isNil()) {
-    Value source = deserialize(*this, binary_parse_data);
-    Value module = loadModule(makeSymbol("lang/parse"), source);
-    parserImpl = eval(*this, makeList(module, makeList(syms.quote, makeSymbol("parse"))), nil);
+  return parse(String(text), multiexpr);
+}
+
+// The parser conses its lists up back to front, interleaved with its own
+// garbage; they are copied into contiguous runs before being handed out.
+static Value contiguous_copy(VM& vm, Value value) {
+  if(!value.isCons()) {
+    return value;
+  }
+  std::vector<Value> items;
+  while(value.isCons()) {
+    items.push_back(contiguous_copy(vm, value->as_cons.first));
+    value = value->as_cons.rest;
   }
-  Value input = makeString(strdup(text));
+  return vm.makeContiguousList(items.data(), items.size(), value);
+}
+
+Value VM::parse(const String& text, bool multiexpr) {
+  suppressInternalRecursion = true;
+  loadParser();
+  Value input = copyString(text);
   Value result = eval(*this, makeList(parserImpl, input, makeBool(multiexpr)), nil);
   suppressInternalRecursion = false;
-  return result;
+  return hashConsing ? result : contiguous_copy(*this, result);
 }
 
 Value VM::loadModule(Value name) {
@@ -213,25 +788,40 @@ Value VM::loadModule(Value name) {
       return loadModule(name, source);
     }
   }
-  printf("unrecognized:");
-  fwrite(name.asSymbolUnsafe().text, name.asSymbolUnsafe().length, 1, stdout);
-  printf("\n");
-  exit(1);
-  VM_EXPECT(*this, 0);
-  return 0;
+  if(is_native_module(name)) {
+    Value module = load_native_module(*this, name);
+    loaded_modules = hashmap_assoc(*this, loaded_modules, name, module);
+    return module;
+  }
+  std::string message = "unrecognized module";
+  if(name.isSymbol()) {
+    const String& text = name.asSymbolUnsafe();
+    message += ": " + std::string(text.text, text.length);
+  }
+  VM_ERROR(*this, message.c_str());
 }
 
 Value VM::loadModule(Value name, Value source) {
   Value moduleFn = eval(*this, source, nil);
   Value module = eval(*this, makeList(moduleFn, objs.builtin_load_module), nil);
-  loaded_modules = makeCons(makeCons(name, module), loaded_modules);
+  loaded_modules = hashmap_assoc(*this, loaded_modules, name, module);
   return module;
 }
 
 void VM::errorOccurred(const char* file, int line, const char* message) {
-  fprintf(stderr, "error occurred: %s:%d: %s\n", file, line, message);
-  currentEvalFrame->dump(StandardStream::StdErr);
-  exit(1);
+  VMError error(file, line, message);
+  if(!tracing) {
+    tracing = true;
+    for(EvalFrame* frame = currentEvalFrame; frame; frame = frame->previous) {
+      try {
+        error.trace.push_back(frame->describe());
+      } catch(const VMError&) {
+        error.trace.push_back("evaluating <unprintable>\n");
+      }
+    }
+    tracing = false;
+  }
+  throw error;
 }
 
 EvalFrame::EvalFrame(VM& vm, Value evaluating, Value env):
@@ -247,84 +837,215 @@ EvalFrame::EvalFrame(VM& vm, Value evaluating, Value env):
   vm.currentEvalFrame = this;
 }
 
+EvalFrame::EvalFrame(VM& vm, Value func, const Value* args, size_t n, Value env):
+  vm(vm),
+  evaluating(func),
+  env(env),
+  previous(vm.currentEvalFrame),
+  args(args),
+  argCount(n)
+{
+  vm.currentEvalFrame = this;
+}
+
 EvalFrame::~EvalFrame() {
   vm.currentEvalFrame = previous;
 }
 
 static bool obj_mentions_symbol(Value obj, Value symbol) {
-  if(obj->type == Object::Type::Cons) {
+  if(obj->type() == Object::Type::Cons) {
     return
       obj_mentions_symbol(obj->as_cons.first, symbol) ||
       obj_mentions_symbol(obj->as_cons.rest, symbol);
-  } else if(obj->type == Object::Type::Symbol) {
+  } else if(obj->type() == Object::Type::Symbol) {
     return obj == symbol;
   } else {
     return false;
   }
 }
 
-void EvalFrame::dump(StandardStream stream) {
-  FILE* f = streamToFile(stream);
+std::string EvalFrame::describe() {
   static const char prefix[] = "evaluating ";
-  fprintf(f, prefix);
-  vm.print(evaluating, strlen(prefix), stream);
+  if(args) {
+    Value call = vm.nil;
+    for(size_t i = argCount; i > 0; i--) {
+      call = vm.makeFreshCons(args[i - 1], call);
+    }
+    evaluating = vm.makeFreshCons(evaluating, call);
+    args = 0;
+  }
+  std::string out = prefix;
+  String text = vm.prettyPrint(evaluating, strlen(prefix));
+  out.append(text.text, text.length);
+  out += "\n";
   Value end = previous ? previous->env : vm.nil;
-  while(!env.isNil() && env != end) {
-    ASSERT(env.isCons());
-    Value pair = env->as_cons.first;
-    env = env->as_cons.rest;
+  for(Value p = env; !p.isNil() && p != end; p = p->as_cons.rest) {
+    ASSERT(p.isCons());
+    Value pair = p->as_cons.first;
     ASSERT(pair.isCons());
     Value key = pair->as_cons.first;
 
     if(obj_mentions_symbol(evaluating, key)) {
-      Value value = pair->as_cons.rest;
       ASSERT(key.isSymbol());
-      const char* text = key->as_symbol.text;
-      size_t length = key->as_symbol.length;
-      int len = fprintf(f, "    where %*s = ", (int)length, text);
-      vm.print(value, len, stream);
+      const String& name = key.asSymbolUnsafe();
+      std::string where = "    where " + std::string(name.text, name.length) + " = ";
+      String value = vm.prettyPrint(pair->as_cons.rest, where.size());
+      out += where;
+      out.append(value.text, value.length);
+      out += "\n";
     }
   }
-  if(previous) {
-    previous->dump(stream);
-  }
+  return out;
 }
 
 static Value list_prepend_n_objs(VM& vm, size_t len, Value obj, Value list) {
   while(len > 0) {
-    list = vm.makeCons(obj, list);
+    list = vm.makeFreshCons(obj, list);
     len--;
   }
   return list;
 }
 
 static bool is_self_evaluating(Value o) {
-  return o.isInteger() || o.isNil() || o.isBuiltin() || o.isBool() || o.isLambda() || o.isString();
+  return o.isInteger() || o.isNil() || o.isBuiltin() || o.isBool() || o.isLambda() || o.isString() || o.isMemoized() || o.isCompiled();
 }
 
-static Value extend_env(VM& vm, Value params, Value args, Value env) {
-  if(!params.isNil()) {
-    if(params.isSymbol()) {
-      return vm.makeCons(
-        vm.makeCons(params, args),
-        env);
-    } else {
-      Cons cp = params.asCons(vm);
-      Cons ca = args.asCons(vm);
-      Value key = cp.first;
-      EXPECT(key.isSymbol());
-      Value value = ca.first;
-      return extend_env(vm,
-        cp.rest,
-        ca.rest,
-        vm.makeCons(vm.makeCons(key, value), env));
+// A call's environment can only be captured by a closure created while its
+// body is evaluated, and only letlambdas creates closures.
+static bool creates_closures(VM& vm, Value o) {
+  if(!o.isCons()) {
+    return false;
+  }
+  Value f = o->as_cons.first;
+  if(f == vm.syms.quote) {
+    return false;
+  } else if(f == vm.syms.letlambdas) {
+    return true;
+  }
+  for(; o.isCons(); o = o->as_cons.rest) {
+    if(creates_closures(vm, o->as_cons.first)) {
+      return true;
     }
-  } else {
-    VM_EXPECT(vm, args.isNil());
-    return env;
   }
+  return false;
 }
 
+static bool contains(const std::vector<Value>& symbols, Value sym) {
+  for(const Value& s : symbols) {
+    if(s == sym) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool collect_params(Value params, std::vector<Value>& out) {
+  for(; params.isCons(); params = params->as_cons.rest) {
+    if(!params->as_cons.first.isSymbol()) {
+      return false;
+    }
+    out.push_back(params->as_cons.first);
+  }
+  if(params.isSymbol()) {
+    out.push_back(params);
+  }
+  return params.isSymbol() || params.isNil();
+}
+
+// Collects the variables `o` refers to that aren't in `bound`.  Returns
+// false for code that doesn't parse, which eval would reject anyway.
+static bool collect_free(VM& vm, Value o, std::vector<Value>& bound, std::vector<Value>& out) {
+  if(o.isSymbol()) {
+    if(!contains(bound, o) && !contains(out, o)) {
+      out.push_back(o);
+    }
+    return true;
+  } else if(!o.isCons()) {
+    return true;
+  }
+  Value f = o->as_cons.first;
+  if(f == vm.syms.quote || f == vm.syms.import) {
+    return true;
+  } else if(f == vm.syms.letlambdas) {
+    Value rest = o->as_cons.rest;
+    if(!rest.isCons() || !rest->as_cons.rest.isCons() || !rest->as_cons.rest->as_cons.rest.isNil()) {
+      return false;
+    }
+    size_t outer = bound.size();
+    Value defs = rest->as_cons.first;
+    for(Value d = defs; d.isCons(); d = d->as_cons.rest) {
+      Value def = d->as_cons.first;
+      if(!def.isCons() || !def->as_cons.first.isCons() || !def->as_cons.rest.isCons()) {
+        return false;
+      }
+      bound.push_back(def->as_cons.first->as_cons.first);
+    }
+    for(Value d = defs; d.isCons(); d = d->as_cons.rest) {
+      Value def = d->as_cons.first;
+      size_t group = bound.size();
+      if(!collect_params(def->as_cons.first->as_cons.rest, bound) ||
+          !collect_free(vm, def->as_cons.rest->as_cons.first, bound, out)) {
+        return false;
+      }
+      bound.resize(group);
+    }
+    bool ok = collect_free(vm, rest->as_cons.rest->as_cons.first, bound, out);
+    bound.resize(outer);
+    return ok;
+  } else if(f == vm.syms.if_) {
+    o = o->as_cons.rest;
+  }
+  for(; o.isCons(); o = o->as_cons.rest) {
+    if(!collect_free(vm, o->as_cons.first, bound, out)) {
+      return false;
+    }
+  }
+  return collect_free(vm, o, bound, out);
+}
+
+// Analyses a letlambdas definition the first time a closure is made from
+// it.  A rest parameter binds the argument list itself, which the body is
+// then free to return, so those frames are treated as escaping too.
+static const LambdaInfo& lambda_info(VM& vm, Value def, Value params, Value body) {
+  auto found = vm.lambdaInfo.find(def.getObj());
+  if(found != vm.lambdaInfo.end()) {
+    return found->second;
+  }
+  LambdaInfo info;
+  std::vector<Value> bound;
+  std::vector<Value> free;
+  bool parsed = collect_params(params, bound);
+  Value p = params;
+  for(; p.isCons(); p = p->as_cons.rest) {}
+  info.frameEscapes = !p.isNil() || creates_closures(vm, body);
+  info.flat = parsed && collect_free(vm, body, bound, free);
+  info.freeVariables = vm.nil;
+  for(size_t i = free.size(); i > 0; i--) {
+    info.freeVariables = vm.makeFreshCons(free[i - 1], info.freeVariables);
+  }
+  return vm.lambdaInfo[def.getObj()] = info;
+}
+
+// A flat closure environment: just the bindings the body can refer to,
+// sharing the binding pairs of `env`.  Variables that aren't bound are left
+// out, so referring to them still fails when the body runs.
+static Value flat_env(VM& vm, Value freeVariables, Value env) {
+  Value flat = vm.nil;
+  for(; !freeVariables.isNil(); freeVariables = freeVariables->as_cons.rest) {
+    Value sym = freeVariables->as_cons.first;
+    for(Value e = env; e.isCons(); e = e->as_cons.rest) {
+      Value pair = e->as_cons.first;
+      if(pair->as_cons.first == sym) {
+        flat = vm.makeFreshCons(pair, flat);
+        break;
+      }
+    }
+  }
+  return flat;
+}
+
+// Closures are created first, with the names of the whole group bound, so
+// that their flat environments can refer to each other.
 static Value make_lambdas_env(VM& vm, Value lambdas, Value env) {
   size_t len = list_length(lambdas);
   Value orig_env = env;
@@ -332,13 +1053,13 @@ static Value make_lambdas_env(VM& vm, Value lambdas, Value env) {
   env = list_prepend_n_objs(vm, len, vm.nil, env);
 
   Value envptr = env;
+  std::vector<const LambdaInfo*> infos;
   while(!lambdas.isNil()) {
     Cons c = lambdas.asCons(vm);
-    Value lambda = c.first;
+    Value def = c.first;
 
-    Cons cl = lambda.asCons(vm);
+    Cons cl = def.asCons(vm);
     Value name_and_params = cl.first;
-    lambda = cl.rest;
     cl = cl.rest.asCons(vm);
     VM_EXPECT(vm, cl.rest.isNil());
     Value body = cl.first;
@@ -348,9 +1069,12 @@ static Value make_lambdas_env(VM& vm, Value lambdas, Value env) {
     EXPECT(name.isSymbol());
     Value params = cl.rest;
 
-    lambda = make_lambda(vm, params, body, env);
+    const LambdaInfo& info = lambda_info(vm, def, params, body);
+    infos.push_back(&info);
+    Value lambda = make_lambda(vm, params, body, env);
+    lambda->as_lambda.frameEscapes = info.frameEscapes;
 
-    envptr->as_cons.first = vm.makeCons(name, lambda);
+    envptr->as_cons.first = vm.makeFreshCons(name, lambda);
     envptr = envptr.asCons(vm).rest;
 
     lambdas = c.rest;
@@ -358,20 +1082,152 @@ static Value make_lambdas_env(VM& vm, Value lambdas, Value env) {
 
   ASSERT(orig_env == envptr);
 
+  if(env.isCons()) {
+    envptr = env;
+    for(const LambdaInfo* info : infos) {
+      Value lambda = envptr->as_cons.first->as_cons.rest;
+      if(info->flat) {
+        lambda->as_lambda.env = flat_env(vm, info->freeVariables, env);
+      }
+      envptr = envptr->as_cons.rest;
+    }
+  }
+
   return env;
 }
 
+// Releases the scratch storage used under a call to eval when it returns.
+// Nothing eval returns can point into it: values bound in scratch frames
+// live on the heap.
+class ScratchScope {
+public:
+  VM& vm;
+  ScratchMark mark;
+
+  ScratchScope(VM& vm): vm(vm), mark(vm.scratchMark()) {}
+  ~ScratchScope() { vm.scratchRelease(mark); }
+};
+
+// The arguments of a call, on the C stack unless there are a lot of them.
+class Arguments {
+public:
+  static const size_t localCount = 8;
+  Value local[localCount];
+  std::vector<Value> spill;
+  size_t count = 0;
+
+  void push(Value value) {
+    if(count < localCount) {
+      local[count] = value;
+    } else {
+      if(count == localCount) {
+        spill.assign(local, local + localCount);
+      }
+      spill.push_back(value);
+    }
+    count++;
+  }
+
+  const Value* data() const {
+    return count <= localCount ? local : spill.data();
+  }
+};
+
 Value eval(VM& vm, Value o, Map env);
+
+// A dotted call like (f a . rest) passes the items of `rest` as well.
+static void eval_args(VM& vm, Value o, Map env, Arguments& args) {
+  for(; o.isCons(); o = o->as_cons.rest) {
+    args.push(eval(vm, o->as_cons.first, env));
+  }
+  if(!o.isNil()) {
+    for(Value rest = eval(vm, o, env); !rest.isNil(); rest = rest.asCons(vm).rest) {
+      args.push(rest.asConsUnsafe().first);
+    }
+  }
+}
+
+static void expect_arity(VM& vm, Value params, size_t n) {
+  size_t count = 0;
+  for(; params.isCons(); params = params->as_cons.rest) {
+    count++;
+  }
+  if(params.isNil()) {
+    VM_EXPECT(vm, n == count);
+  } else {
+    VM_EXPECT(vm, n >= count);
+  }
+}
+
+// Binds the parameters of `l` straight from the argument vector; only a
+// rest parameter gets a list.  Frames that can't escape are bound in
+// scratch storage.
+static Value bind_args(VM& vm, const Lambda& l, const Value* args, size_t n) {
+  Value env = l.env;
+  Value params = l.params;
+  size_t i = 0;
+  for(; params.isCons(); params = params->as_cons.rest, i++) {
+    Value key = params->as_cons.first;
+    EXPECT(key.isSymbol());
+    env = l.frameEscapes
+      ? vm.makeFreshCons(vm.makeFreshCons(key, args[i]), env)
+      : vm.makeScratchCons(vm.makeScratchCons(key, args[i]), env);
+  }
+  if(!params.isNil()) {
+    Value rest = vm.nil;
+    for(size_t j = n; j > i; j--) {
+      rest = vm.makeFreshCons(args[j - 1], rest);
+    }
+    env = vm.makeFreshCons(vm.makeFreshCons(params, rest), env);
+  }
+  return env;
+}
+
 static Value eval_list(VM& vm, Value o, Map env) {
   if(o.isCons()) {
     Cons c = o.asConsUnsafe();
-    return vm.makeCons(eval(vm, c.first, env), eval_list(vm, c.rest, env));
+    return vm.makeFreshCons(eval(vm, c.first, env), eval_list(vm, c.rest, env));
   } else {
     return eval(vm, o, env);
   }
 }
 
+Value apply(VM& vm, Value func, const Value* args, size_t n) {
+  if(func.isBuiltin()) {
+    EvalFrame builtinFrame(vm, func, args, n, vm.nil);
+    return builtin_func(func)(vm, args, n);
+  } else if(func.isMemoized()) {
+    Value list = vm.nil;
+    for(size_t i = n; i > 0; i--) {
+      list = vm.makeFreshCons(args[i - 1], list);
+    }
+    return memo_call(vm, func, list);
+  } else if(func.isCompiled()) {
+    return call_compiled(vm, func, args, n);
+  }
+  Lambda l = func.asLambda(vm);
+  expect_arity(vm, l.params, n);
+  Value result;
+  if(vm.jitMode != JitMode::Off && jit_call(vm, func, args, n, result)) {
+    return result;
+  }
+  ScratchScope scratch(vm);
+  return eval(vm, l.body, bind_args(vm, l, args, n));
+}
+
+Value apply(VM& vm, Value func, Value args) {
+  if(func.isMemoized()) {
+    return memo_call(vm, func, args);
+  }
+  Arguments values;
+  for(; !args.isNil(); args = args.asCons(vm).rest) {
+    values.push(args.asConsUnsafe().first);
+  }
+  return apply(vm, func, values.data(), values.count);
+}
+
 Value eval(VM& vm, Value o, Map env) {
+  ScratchScope scratch(vm);
   while(true) {
     EvalFrame frame(vm, o, env);
     if(is_self_evaluating(o)) {
@@ -414,19 +1270,29 @@ Value eval(VM& vm, Value o, Map env) {
         return a;
       } else {
         f = eval(vm, f, env);
+        if(f.isMemoized()) {
+          return memo_call(vm, f, eval_list(vm, o, env));
+        } else if(!f.isBuiltin() && !f.isLambda() && !f.isCompiled()) {
+          VM_ERROR(vm, "calling non-function value");
+          return 0;
+        }
+        Arguments args;
+        eval_args(vm, o, env, args);
         if(f.isBuiltin()) {
-          Value params = eval_list(vm, o, env);
-          EvalFrame builtinFrame(vm, vm.makeCons(f, params), env);
-          Value res = builtin_func(f)(vm, params);
-          return res;
-        } else if(f.isLambda()) {
+          EvalFrame builtinFrame(vm, f, args.data(), args.count, env);
+          return builtin_func(f)(vm, args.data(), args.count);
+        } else if(f.isCompiled()) {
+          return call_compiled(vm, f, args.data(), args.count);
+        } else {
           Lambda l = f.asLambdaUnsafe();
-          Value params = eval_list(vm, o, env);
-          env = extend_env(vm, l.params, params, l.env);
+          expect_arity(vm, l.params, args.count);
+          Value result;
+          if(vm.jitMode != JitMode::Off && jit_call(vm, f, args.data(), args.count, result)) {
+            return result;
+          }
+          vm.scratchRelease(scratch.mark);
+          env = bind_args(vm, l, args.data(), args.count);
           o = l.body;
-        } else {
-          VM_ERROR(vm, "calling non-function value");
-          return 0;
         }
       }
     } else {
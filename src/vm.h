@@ -1,9 +1,40 @@
+#ifndef MYLISP_VM_H_
+#define MYLISP_VM_H_
+
 #include <stdio.h>
 
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "value.h"
+#include "heap.h"
 #include "stream.h"
+#include "jit.h"
+
+// What VM_ERROR and failed assertions throw.  The VM stays usable once the
+// error is caught: the frames it unwound through have been popped, and
+// their scratch storage released.
+class VMError {
+public:
+  std::string message;
+  const char* file;
+  int line;
+  bool assertion = false;
+
+  // What each eval frame was evaluating when the error was raised,
+  // innermost first, along with the values of the variables it mentions.
+  std::vector<std::string> trace;
+
+  VMError(const char* file, int line, const std::string& message):
+    message(message), file(file), line(line) {}
 
-void _assert_failed(const char* file, int line, const char* message, ...);
+  void print(FILE* f) const;
+};
+
+[[noreturn]] void _assert_failed(const char* file, int line, const char* message, ...);
 
 #define EXPECT(e) do { if(!(e)) {_assert_failed(__FILE__, __LINE__, "%s", #e);} } while(0)
 #define EXPECT_MSG(e, msg, ...) \
@@ -42,15 +73,79 @@ public:
   Syms(VM& vm);
 };
 
-struct heap_block_t;
+class ScratchMark {
+public:
+  heap_block_t* block;
+  size_t used;
+};
+
+// What make_lambdas_env needs to know about a definition to build
+// closures from it.
+class LambdaInfo {
+public:
+  // Whether a call's environment can outlive the call; see Lambda.
+  bool frameEscapes;
+
+  // Closures of flat definitions only capture the bindings of
+  // `freeVariables`, instead of the whole environment they're created in.
+  bool flat;
+  Value freeVariables;
+};
+
 class EvalFrame;
+class ThreadPool;
+class ActorSystem;
+class HashConsTable;
+class HashConsStats;
+class MemoCache;
+class Port;
 
 class VM {
 private:
+  // Scratch blocks are all heap_block_size; the heap and symbol heap
+  // start there and grow geometrically.
   size_t heap_block_size;
-  heap_block_t* heap;
+  PagedHeap heap;
+
+  // Symbols are shared by every VM spawned from the same root, so they live
+  // in their own heap, guarded by sharedLock.
+  PagedHeap symbolHeap;
+  std::mutex sharedLock;
+
+  // Blocks handed over by freeze().  They belong to the root and outlive
+  // every VM in the family, so values in them can be shared by pointer.
+  heap_block_t* frozenHeap = 0;
+
+  // Stack-like storage for call frames that can't outlive their call.  It
+  // is released back to a mark rather than freed piece by piece.  Only
+  // conses are made there, so every page of it is a cons page.
+  heap_block_t* scratch;
+  heap_block_t* spareScratch = 0;
+
+  // Kept by the root for the whole family.  Once the limit has been
+  // reported, blocks are handed out past it so the error can be printed.
+  std::atomic<size_t> reservedBytes{0};
+  size_t memoryLimit = 0;
+  std::atomic<bool> limitExceeded{false};
 
 public:
+  VM* root;
+  ThreadPool* pool = 0;
+  ActorSystem* actors = 0;
+  HashConsTable* hashConsTable = 0;
+  MemoCache* memoCaches = 0;
+  Port* ports = 0;
+  Port* stdoutPort = 0;
+  size_t actorId = 0;
+
+  // When set, makeCons interns cells in the root's hash-cons table.  Child
+  // VMs inherit the setting.
+  bool hashConsing = false;
+
+  // Child VMs inherit the mode, but compile code of their own.
+  JitMode jitMode = JitMode::Off;
+  Jit* jit = 0;
+
   Value nil;
   Value true_;
   Value false_;
@@ -69,6 +164,14 @@ public:
 
   EvalFrame* currentEvalFrame = 0;
 
+  // A tail call compiled code returned instead of making; see
+  // call_compiled.
+  Value tailFunc;
+  std::vector<Value> tailArgs;
+
+  // Analysis results, by letlambdas definition.
+  std::unordered_map<Object*, LambdaInfo> lambdaInfo;
+
   Value prettyPrinterImpl;
   Value transformerImpl;
   Value parserImpl;
@@ -76,12 +179,61 @@ public:
   bool suppressInternalRecursion = false;
 
   VM(size_t heap_block_size = 4096);
+  VM(VM& parent, size_t heap_block_size = 4096);
   ~VM();
 
+  // Memory that isn't an object, such as the nodes of vectors and maps.
   void* alloc(size_t size);
 
+  Object* allocObject(Object::Type type, size_t extra = 0);
+  Object* allocHashConsedCell();
+
+  // This VM's own blocks, plus the symbol and frozen heaps for the root.
+  HeapStats heapStats();
+
+  // Bytes held by every VM in the family.
+  size_t familyReserved();
+
+  // Allocating a block that would take the family past `bytes` raises a VM
+  // error.  0 means no limit.
+  void setMemoryLimit(size_t bytes);
+
+  void adoptHeap(VM& other);
+  void freezeHeap(VM& other);
+  bool isFrozen(Value value);
+
+  ScratchMark scratchMark();
+  void scratchRelease(ScratchMark mark);
+  size_t scratchInUse();
+  Value makeScratchCons(Value first, Value rest);
+
+  ThreadPool& threadPool();
+  ActorSystem& actorSystem();
+
+  // Whether an actor spawned by this VM's family is still running.
+  bool actorsRunning();
+
   Value makeCons(Value first, Value rest);
 
+  // A cell that is never shared through the hash-cons table, for code that
+  // patches cells after building them.
+  Value makeFreshCons(Value first, Value rest);
+
+  // A list of `items` ending in `tail`, with its cells laid out one after
+  // another so that walking it is a sequential scan.  Runs break only at
+  // page boundaries.  Hash-consing VMs intern the cells instead.
+  Value makeContiguousList(const Value* items, size_t n, Value tail);
+
+  HashConsStats hashConsStats();
+
+  // Hands `cache` to the root VM, which frees it on destruction.
+  MemoCache* registerMemoCache(MemoCache* cache);
+
+  // Ports are kept by the root until it is destroyed.
+  Port* registerPort(Port* port);
+  Port* standardOutputPort();
+  void flushPorts();
+
   inline Value makeList() { return nil; }
 
   template<class T, class... TS>
@@ -91,17 +243,78 @@ public:
 
   Value makeSymbol(const String& name);
   Value makeString(const String& value);
+
+  // Strings whose bytes follow the object in the same heap allocation.
+  // allocString leaves the bytes for the caller to fill in.
+  Value allocString(size_t length);
+  Value copyString(const String& value);
   Value makeInteger(int value);
   inline Value makeBool(bool value) { return value ? true_ : false_; }
 
+  // The parser, transformer and prettyprinter are loaded on first use;
+  // this loads all of them up front.
+  void loadBootModules();
+
   void print(Value value, int indent = 0, StandardStream stream = StandardStream::StdOut);
+  String prettyPrint(Value value, int indent = 0);
   Value transform(Value value);
   Value parse(const char* text, bool multiexpr = false);
+  Value parse(const String& text, bool multiexpr = false);
 
   Value loadModule(Value name);
   Value loadModule(Value name, Value source);
 
-  void errorOccurred(const char* file, int line, const char* message);
+  [[noreturn]] void errorOccurred(const char* file, int line, const char* message);
+
+  // reset() returns the root to the state it was in at the last checkpoint,
+  // which the constructor takes and a server takes again once the boot
+  // modules are loaded.  Everything allocated since is freed, along with
+  // the actors, memo caches and ports made since; memo caches from before
+  // are emptied, and native code is compiled again as it gets hot.
+  // Symbols are kept.  Only call reset() outside of eval; it waits for the
+  // actors to finish.
+  void checkpoint();
+  void reset();
+
+private:
+  class Checkpoint {
+  public:
+    // Blocks filled before the checkpoint, which reset() doesn't touch.
+    heap_block_t* keptBlocks = 0;
+
+    // A copy of the table as it was, owned by the checkpoint.
+    HashConsTable* hashConsTable = 0;
+
+    heap_block_t* frozenHeap = 0;
+    MemoCache* memoCaches = 0;
+    Port* ports = 0;
+    Value loadedModules;
+    Value prettyPrinterImpl;
+    Value transformerImpl;
+    Value parserImpl;
+  };
+
+  Checkpoint saved;
+
+  // Set while an error's trace is being printed, so that an error raised
+  // by the printing doesn't try to print its own.
+  bool tracing = false;
+
+  heap_block_t* newBlock(size_t size, heap_block_t* next);
+  void freeBlocks(heap_block_t* chain);
+
+  // Runs `f` with the shared lock held.  A block that can't be had in the
+  // meantime is raised once the lock is released, since tracing the error
+  // evaluates code that may need the lock itself.
+  template<typename F>
+  Value underSharedLock(F f);
+  Value internSymbol(const String& name);
+  void* heapAlloc(PagedHeap& heap, size_t kind, Object::Type type, size_t size);
+  uint8_t* takePages(PagedHeap& heap, size_t count);
+
+  void loadPrettyPrinter();
+  void loadTransformer();
+  void loadParser();
 };
 
 class EvalFrame {
@@ -111,11 +324,24 @@ public:
   Value env;
   EvalFrame* previous;
 
+  // Set for builtin calls, whose argument vector only becomes a list when
+  // the frame is described.
+  const Value* args = 0;
+  size_t argCount = 0;
+
   EvalFrame(VM& vm, Value evaluating, Value env);
+  EvalFrame(VM& vm, Value func, const Value* args, size_t n, Value env);
 
   ~EvalFrame();
 
-  void dump(StandardStream stream);
+  // An entry of VMError::trace.
+  std::string describe();
 };
 
 Value eval(VM& vm, Value o, Map env);
+
+Value apply(VM& vm, Value func, Value args);
+
+Value apply(VM& vm, Value func, const Value* args, size_t n);
+
+#endif
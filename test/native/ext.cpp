@@ -0,0 +1,26 @@
+#include "native.h"
+
+static int64_t fib(int64_t n) {
+  int64_t a = 0;
+  int64_t b = 1;
+  for(int64_t i = 0; i < n; i++) {
+    int64_t next = a + b;
+    a = b;
+    b = next;
+  }
+  return a;
+}
+
+static Value pair(VM& vm, Value a, Value b) {
+  return vm.makeCons(a, b);
+}
+
+static bool longer(String a, String b) {
+  return a.length > b.length;
+}
+
+extern "C" void mylisp_init_module(NativeModule& module) {
+  module.define("fib", BIND_BUILTIN(fib));
+  module.define("pair", BIND_BUILTIN(pair));
+  module.define("longer?", BIND_BUILTIN(longer));
+}
@@ -1,8 +1,30 @@
+#include <errno.h>
+#include <limits.h>
 #include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include "vm.h"
 #include "serialize.h"
 #include "interpret.h"
+#include "actor.h"
+#include "vector.h"
+#include "hashmap.h"
+#include "array.h"
+#include "text.h"
+#include "hashcons.h"
+#include "memo.h"
+#include "optimize.h"
+#include "native.h"
+#include "compiled.h"
+#include "macroexpand.h"
+#include "server.h"
+#include "reader.h"
+#include "port.h"
+#include "builtin.h"
+#include "heap.h"
 
 void testMakeList() {
   VM vm;
@@ -236,6 +258,1030 @@ void testInterpret() {
   EXPECT_INT_EQ(values[2].asInteger(vm), 3);
 }
 
+void testParallel() {
+  VM vm;
+
+  Value square = eval(vm, vm.parse("(letlambdas (((sq x) ((import core *) x x))) sq)"), vm.nil);
+  Value isEven = eval(vm, vm.parse("(letlambdas (((even x) ((import core eq?) ((import core modulo) x 2) 0))) even)"), vm.nil);
+  Value add = vm.objs.builtin_add;
+
+  Value pmap = map_lookup(vm, vm.core_imports, vm.syms.pmap);
+  Value pfilter = map_lookup(vm, vm.core_imports, vm.syms.pfilter);
+  Value preduce = map_lookup(vm, vm.core_imports, vm.syms.preduce);
+
+  for(int length = 0; length <= 1000; length += 250) {
+    Value items = vm.nil;
+    Value squares = vm.nil;
+    Value evens = vm.nil;
+    for(int i = length - 1; i >= 0; i--) {
+      items = vm.makeCons(vm.makeInteger(i), items);
+      squares = vm.makeCons(vm.makeInteger(i * i), squares);
+      if(i % 2 == 0) {
+        evens = vm.makeCons(vm.makeInteger(i), evens);
+      }
+    }
+    Value quoted = vm.makeList(vm.syms.quote, items);
+
+    EXPECT(eval(vm, vm.makeList(pmap, square, quoted), vm.nil) == squares);
+    EXPECT(eval(vm, vm.makeList(pfilter, isEven, quoted), vm.nil) == evens);
+    EXPECT_INT_EQ(length * (length - 1) / 2 + 7,
+      eval(vm, vm.makeList(preduce, add, vm.makeInteger(7), quoted), vm.nil).asInteger(vm));
+  }
+}
+
+void testActors() {
+  VM vm;
+
+  Value send = map_lookup(vm, vm.core_imports, vm.syms.send);
+  Value receive = map_lookup(vm, vm.core_imports, vm.syms.receive);
+  Value freeze = map_lookup(vm, vm.core_imports, vm.syms.freeze);
+
+  Value doubler = eval(vm, vm.parse(
+    "(letlambdas (((start parent) (letlambdas (((run) "
+    "  ((import core send) parent ((import core *) ((import core receive)) 2)))) run))) start)"), vm.nil);
+  Value echo = eval(vm, vm.parse(
+    "(letlambdas (((start parent) (letlambdas (((run) "
+    "  ((import core send) parent ((import core receive))))) run))) start)"), vm.nil);
+  Value self = apply(vm, map_lookup(vm, vm.core_imports, vm.syms.self), vm.nil);
+  EXPECT_INT_EQ(0, self.asInteger(vm));
+
+  {
+    Value id = apply(vm, map_lookup(vm, vm.core_imports, vm.syms.spawn),
+      vm.makeList(apply(vm, doubler, vm.makeList(self))));
+    apply(vm, send, vm.makeList(id, vm.makeInteger(21)));
+    EXPECT_INT_EQ(42, apply(vm, receive, vm.nil).asInteger(vm));
+  }
+
+  {
+    Value data = vm.makeList(vm.makeInteger(1), vm.makeString("two"), vm.makeSymbol("three"));
+    Value frozen = apply(vm, freeze, vm.makeList(data));
+    EXPECT(frozen == data);
+    EXPECT(frozen.getObj() != data.getObj());
+    EXPECT(vm.isFrozen(frozen));
+    EXPECT(!vm.isFrozen(data));
+
+    Value id = apply(vm, map_lookup(vm, vm.core_imports, vm.syms.spawn),
+      vm.makeList(apply(vm, echo, vm.makeList(self))));
+    apply(vm, send, vm.makeList(id, frozen));
+    Value received = apply(vm, receive, vm.nil);
+    EXPECT(received.getObj() == frozen.getObj());
+
+    id = apply(vm, map_lookup(vm, vm.core_imports, vm.syms.spawn),
+      vm.makeList(apply(vm, echo, vm.makeList(self))));
+    apply(vm, send, vm.makeList(id, data));
+    received = apply(vm, receive, vm.nil);
+    EXPECT(received == data);
+    EXPECT(received.getObj() != data.getObj());
+  }
+
+  {
+    // A failing actor's error comes back to its spawner, once through
+    // receive and again for a send to it.
+    Value failing = eval(vm, vm.parse("(letlambdas (((run) ((import core +) 1 (quote a)))) run)"), vm.nil);
+    Value id = apply(vm, map_lookup(vm, vm.core_imports, vm.syms.spawn), vm.makeList(failing));
+    for(Value builtin : {receive, send}) {
+      std::string message;
+      bool traced = false;
+      try {
+        apply(vm, builtin, builtin == send ? vm.makeList(id, vm.nil) : vm.nil);
+      } catch(const VMError& error) {
+        message = error.message;
+        traced = !error.trace.empty();
+      }
+      EXPECT(message.find("actor 4 failed: ") == 0 && traced);
+    }
+    EXPECT(vm.currentEvalFrame == 0);
+  }
+}
+
+void testVector() {
+  VM vm;
+
+  Value v = make_vector(vm, 0, 0);
+  for(int i = 0; i < 1100; i++) {
+    Value pushed = vector_push(vm, v, vm.makeInteger(i));
+    EXPECT_INT_EQ(i, (int)v.asVector(vm).length);
+    v = pushed;
+  }
+  EXPECT_INT_EQ(1100, (int)v.asVector(vm).length);
+  for(int i = 0; i < 1100; i++) {
+    EXPECT_INT_EQ(i, vector_get(v.asVector(vm), i).asInteger(vm));
+  }
+
+  Value list = vector_to_list(vm, v);
+  EXPECT_INT_EQ(1100, (int)list_length(list));
+  EXPECT(vector_from_list(vm, list) == v);
+
+  Value changed = vector_set(vm, v, 1037, vm.makeSymbol("x"));
+  EXPECT(vector_get(changed.asVector(vm), 1037) == vm.makeSymbol("x"));
+  EXPECT_INT_EQ(1037, vector_get(v.asVector(vm), 1037).asInteger(vm));
+  EXPECT(changed != v);
+
+  {
+    Value input = vm.parse(
+      "((import core vector-slice) ((import core vector-append) ((import core vector) 1 2) ((import core vector) 3 4 5)) 1 4)");
+    Value expected = vm.makeList(vm.makeInteger(2), vm.makeInteger(3), vm.makeInteger(4));
+    EXPECT(eval(vm, input, vm.nil) == vector_from_list(vm, expected));
+  }
+
+  {
+    String serialized = serialize(changed);
+    Value deserialized = deserialize(vm, serialized.text);
+    EXPECT(deserialized == changed);
+  }
+}
+
+void testHashMap() {
+  VM vm;
+
+  Value m = make_hashmap(vm);
+  for(int i = 0; i < 2000; i++) {
+    Value assoc = hashmap_assoc(vm, m, vm.makeInteger(i), vm.makeInteger(i * 2));
+    EXPECT_INT_EQ(i, (int)m.asHashMap(vm).count);
+    m = assoc;
+  }
+  EXPECT_INT_EQ(2000, (int)m.asHashMap(vm).count);
+  for(int i = 0; i < 2000; i++) {
+    EXPECT_INT_EQ(i * 2, map_lookup(vm, m, vm.makeInteger(i)).asInteger(vm));
+  }
+  EXPECT(hashmap_assoc(vm, m, vm.makeInteger(5), vm.makeInteger(10)).asHashMap(vm).count == 2000);
+
+  Value removed = m;
+  for(int i = 0; i < 2000; i += 2) {
+    removed = hashmap_dissoc(vm, removed, vm.makeInteger(i));
+  }
+  EXPECT_INT_EQ(1000, (int)removed.asHashMap(vm).count);
+  for(int i = 0; i < 2000; i++) {
+    Value found;
+    EXPECT(hashmap_find(removed, vm.makeInteger(i), found) == (i % 2 == 1));
+    EXPECT(hashmap_find(m, vm.makeInteger(i), found));
+  }
+
+  {
+    Value alist = vm.makeList(
+      vm.makeCons(vm.makeString("a"), vm.makeInteger(1)),
+      vm.makeCons(vm.makeList(vm.makeSymbol("b")), vm.makeInteger(2)));
+    Value a = hashmap_from_alist(vm, alist);
+    Value b = hashmap_from_alist(vm, vm.makeList(
+      vm.makeCons(vm.makeList(vm.makeSymbol("b")), vm.makeInteger(2)),
+      vm.makeCons(vm.makeString("a"), vm.makeInteger(1))));
+    EXPECT(a == b);
+    EXPECT(value_hash(a) == value_hash(b));
+    EXPECT(value_hash(vm.makeString("a")) == value_hash(vm.makeString("a")));
+    EXPECT_INT_EQ(2, map_lookup(vm, a, vm.makeList(vm.makeSymbol("b"))).asInteger(vm));
+    EXPECT(hashmap_dissoc(vm, a, vm.makeString("a")) != b);
+  }
+
+  {
+    Value input = vm.parse(
+      "((import core hash-get) ((import core hash-assoc) ((import core hash-map) 1 2) 3 4) 3)");
+    EXPECT_INT_EQ(4, eval(vm, input, vm.nil).asInteger(vm));
+  }
+
+  {
+    String serialized = serialize(removed);
+    Value deserialized = deserialize(vm, serialized.text);
+    EXPECT(deserialized == removed);
+  }
+}
+
+void testArray() {
+  VM vm;
+
+  const size_t length = 1003;
+  Value a = make_array(vm, length);
+  Value b = make_array(vm, length);
+  int64_t sum = 0, dot = 0;
+  for(size_t i = 0; i < length; i++) {
+    int64_t x = (int64_t)(i * 7919 % 1000) - 500;
+    int64_t y = (int64_t)i - 3000000000LL;
+    a.asArray(vm).data[i] = x;
+    b.asArray(vm).data[i] = y;
+    sum += x;
+    dot += x * y;
+  }
+  EXPECT(array_sum(vm, a) == sum);
+  EXPECT(array_dot(vm, a, b) == dot);
+  EXPECT(array_min(vm, a) == -500);
+  EXPECT(array_max(vm, a) == 499);
+  EXPECT(array_min(vm, b) == -3000000000LL);
+
+  Value added = array_add(vm, a, b);
+  Value multiplied = array_mul(vm, a, b);
+  Value less = array_less(vm, a, b);
+  Value greater = array_less(vm, b, a);
+  for(size_t i = 0; i < length; i++) {
+    int64_t x = a.asArray(vm).data[i];
+    int64_t y = b.asArray(vm).data[i];
+    EXPECT(added.asArray(vm).data[i] == x + y);
+    EXPECT(multiplied.asArray(vm).data[i] == x * y);
+    EXPECT(less.asArray(vm).data[i] == 0);
+    EXPECT(greater.asArray(vm).data[i] == 1);
+  }
+
+  {
+    Value input = vm.parse(
+      "((import core array-dot) ((import core array-range) 10) ((import core array) 1 1 1 1 1 1 1 1 1 2))");
+    EXPECT_INT_EQ(54, eval(vm, input, vm.nil).asInteger(vm));
+  }
+
+  {
+    String serialized = serialize(b);
+    Value deserialized = deserialize(vm, serialized.text);
+    EXPECT(deserialized == b);
+    EXPECT(deserialized != a);
+  }
+}
+
+void testText() {
+  VM vm;
+
+  String str("the quick brown fox jumps over the lazy dog; \"escaped\"\n");
+  EXPECT_INT_EQ(4, (int)text_find_byte(str, 0, 'q'));
+  EXPECT_INT_EQ(38, (int)text_find_byte(str, 5, 'y'));
+  EXPECT_INT_EQ((int)str.length, (int)text_find_byte(str, 0, '!'));
+  EXPECT_INT_EQ(31, (int)text_find(str, 4, String("the")));
+  EXPECT_INT_EQ((int)str.length, (int)text_find(str, 32, String("the")));
+  EXPECT_INT_EQ(3, (int)text_span(str, 0, String("eht")));
+  EXPECT_INT_EQ(43, (int)text_span(str, 0, String("abcdefghijklmnopqrstuvwxyz ")));
+  EXPECT_INT_EQ(45, (int)text_break(str, 0, String("\"\\\n")));
+  EXPECT_INT_EQ(43, (int)text_break(str, 0, String(";")));
+
+  {
+    Value input = vm.parse("((import core string-escape) ((import core substring) \"say \\\"hi\\\"\\n\" 4))");
+    EXPECT(eval(vm, input, vm.nil) == vm.makeString("\\\"hi\\\"\\n"));
+  }
+
+  {
+    Value input = vm.parse("((import core string-to-int) ((import core int-to-string) ((import core -) 1234)))");
+    EXPECT_INT_EQ(-1234, eval(vm, input, vm.nil).asInteger(vm));
+    EXPECT(eval(vm, vm.parse("((import core string-to-int) \"12a\")"), vm.nil).isNil());
+    EXPECT(eval(vm, vm.parse("((import core string-index-of) \"abc\" \"d\")"), vm.nil).isNil());
+    EXPECT_INT_EQ(98, eval(vm, vm.parse("((import core char-code) \"abc\" 1)"), vm.nil).asInteger(vm));
+  }
+}
+
+void testConcat() {
+  VM vm;
+
+  String acc("");
+  for(int i = 0; i < 1000; i++) {
+    String parts[] = { acc, String("ab") };
+    acc = text_concat(vm, parts, 2);
+  }
+  EXPECT_INT_EQ(2000, (int)acc.length);
+  EXPECT(acc.chunk != 0);
+  EXPECT(acc.text[1998] == 'a' && acc.text[1999] == 'b');
+
+  {
+    String parts[] = { acc, String("x") };
+    String grown = text_concat(vm, parts, 2);
+    EXPECT(grown.text == acc.text);
+
+    String other[] = { acc, String("y") };
+    String branched = text_concat(vm, other, 2);
+    EXPECT(branched.text != acc.text);
+    EXPECT(grown.text[2000] == 'x');
+    EXPECT(branched.text[2000] == 'y');
+  }
+
+  {
+    Value input = vm.parse("((import core concat) \"a\" \"\" \"bc\")");
+    EXPECT(eval(vm, input, vm.nil) == vm.makeString("abc"));
+  }
+}
+
+void testStringStorage() {
+  VM vm;
+
+  {
+    Value str = vm.copyString(String("inline"));
+    EXPECT(str.asString(vm).text == (const char*)str.getObj() + object_size(Object::Type::String));
+    EXPECT(str == vm.makeString("inline"));
+  }
+
+  {
+    char name[] = "transient";
+    Value sym = vm.makeSymbol(String(name));
+    name[0] = 'X';
+    EXPECT(sym.asSymbol(vm) == String("transient"));
+    EXPECT(sym == vm.makeSymbol("transient"));
+  }
+
+  {
+    char big[10000];
+    memset(big, 'z', sizeof(big));
+    Value str = vm.copyString(String(big, sizeof(big)));
+    EXPECT(str.asString(vm) == String(big, sizeof(big)));
+  }
+
+  {
+    Value value = vm.makeList(vm.makeString("a"), vm.makeSymbol("b"));
+    String serialized = serialize(value);
+    Value deserialized = deserialize(vm, serialized.text);
+    EXPECT(deserialized == value);
+  }
+}
+
+void testHashCons() {
+  VM vm;
+
+  Value fresh = vm.makeList(vm.makeString("a"), vm.makeList(vm.makeInteger(1)), vm.makeSymbol("b"));
+  vm.hashConsing = true;
+
+  Value a = vm.makeList(vm.makeString("a"), vm.makeList(vm.makeInteger(1)), vm.makeSymbol("b"));
+  Value b = vm.makeList(vm.makeString("a"), vm.makeList(vm.makeInteger(1)), vm.makeSymbol("b"));
+  EXPECT(a.getObj() == b.getObj());
+  EXPECT(a == fresh);
+  EXPECT(value_hash(a) == value_hash(fresh));
+  EXPECT(vm.makeList(vm.makeInteger(2)) != vm.makeList(vm.makeInteger(1)));
+
+  HashConsStats stats = vm.hashConsStats();
+  EXPECT(stats.hits >= 4);
+  EXPECT(stats.bytesSaved == stats.hits * object_size(Object::Type::Cons));
+
+  {
+    Value deserialized = deserialize(vm, serialize(vm.makeList(fresh, fresh)).text);
+    Cons c = deserialized.asCons(vm);
+    EXPECT(c.first.getObj() == a.getObj());
+    EXPECT(c.rest.asCons(vm).first.getObj() == a.getObj());
+  }
+
+  {
+    // Environments are patched in place by letlambdas, so they must not be
+    // shared even when the code that builds them is.
+    const char* source =
+      "(letlambdas (((f n) (if ((import core eq?) n 0) 7 (g ((import core -) n 1)))) "
+      "             ((g n) (f n))) "
+      "  (f 10))";
+    EXPECT_INT_EQ(7, eval(vm, vm.parse(source), vm.nil).asInteger(vm));
+    EXPECT_INT_EQ(7, eval(vm, vm.parse(source), vm.nil).asInteger(vm));
+  }
+}
+
+void testMemoize() {
+  VM vm;
+
+  {
+    // Recursive calls go through the memoized function passed as `self`.
+    Value input = vm.parse(
+      "(letlambdas (((fib self n) "
+      "    (if ((import core eq?) n 0) 0 "
+      "      (if ((import core eq?) n 1) 1 "
+      "        ((import core +) (self self ((import core -) n 1)) (self self ((import core -) n 2)))))) "
+      "  ((run memo) (memo memo 25))) "
+      "  (run ((import core memoize) fib)))");
+    EXPECT_INT_EQ(75025, eval(vm, input, vm.nil).asInteger(vm));
+  }
+
+  Value add = map_lookup(vm, vm.core_imports, vm.syms.add);
+  Value memo = make_memoized(vm, add, 2);
+  Value oneTwo = vm.makeList(vm.makeInteger(1), vm.makeInteger(2));
+  EXPECT_INT_EQ(3, apply(vm, memo, oneTwo).asInteger(vm));
+  EXPECT_INT_EQ(3, apply(vm, memo, vm.makeList(vm.makeInteger(1), vm.makeInteger(2))).asInteger(vm));
+  EXPECT_INT_EQ(7, apply(vm, memo, vm.makeList(vm.makeInteger(3), vm.makeInteger(4))).asInteger(vm));
+  EXPECT_INT_EQ(11, apply(vm, memo, vm.makeList(vm.makeInteger(5), vm.makeInteger(6))).asInteger(vm));
+  EXPECT_INT_EQ(3, apply(vm, memo, oneTwo).asInteger(vm));
+
+  MemoStats stats = memo.asMemoized(vm).cache->snapshot();
+  // (1 2) was hit before the cache filled up, so (3 4) is evicted instead.
+  EXPECT_INT_EQ(2, (int)stats.hits);
+  EXPECT_INT_EQ(3, (int)stats.misses);
+  EXPECT_INT_EQ(1, (int)stats.evictions);
+
+  // A huge capacity costs nothing until it is filled.
+  Value roomy = make_memoized(vm, add, 2000000000);
+  EXPECT_INT_EQ(3, apply(vm, roomy, oneTwo).asInteger(vm));
+}
+
+void testOptimize() {
+  VM vm;
+
+  {
+    Value input = vm.parse("(letlambdas (((current-let x y) ((import core +) x y))) (current-let 1 2))");
+    OptimizeStats stats;
+    Value output = optimize(vm, input, OptimizeOptions(), &stats);
+    EXPECT_INT_EQ(3, output.asInteger(vm));
+    EXPECT_INT_EQ(1, (int)stats.betaReductions);
+    EXPECT_INT_EQ(2, (int)stats.folds);
+  }
+
+  {
+    // `double` is inlined, after which neither definition is used.
+    Value input = vm.parse(
+      "(letlambdas (((double n) ((import core +) n n)) ((unused) 0)) "
+      "  (double 21))");
+    OptimizeStats stats;
+    Value output = optimize(vm, input, OptimizeOptions(), &stats);
+    EXPECT_INT_EQ(42, output.asInteger(vm));
+    EXPECT_INT_EQ(1, (int)stats.inlines);
+    EXPECT_INT_EQ(2, (int)stats.removedBindings);
+  }
+
+  {
+    // Substituting `y` for `x` directly would capture it in the inner lambda.
+    Value input = vm.parse(
+      "((letlambdas (((outer y) "
+      "    (letlambdas (((current-let x) (letlambdas (((current-lambda y) x)) current-lambda))) "
+      "      (current-let y)))) "
+      "  (outer ((import core +) 2 3))) 0)");
+    Value output = optimize(vm, input);
+    EXPECT_INT_EQ(5, eval(vm, input, vm.nil).asInteger(vm));
+    EXPECT_INT_EQ(5, eval(vm, output, vm.nil).asInteger(vm));
+  }
+
+  {
+    // Arguments with effects are kept even when the parameter is unused.
+    Value input = vm.parse("(letlambdas (((current-let x) 1)) (current-let (f)))");
+    Value output = optimize(vm, input);
+    EXPECT(output == input);
+
+    OptimizeOptions options;
+    options.maxPasses = 1;
+    OptimizeStats stats;
+    optimize(vm, input, options, &stats);
+    EXPECT_INT_EQ(1, (int)stats.passes);
+  }
+
+  {
+    // Unbound variables and unknown imports still raise when optimized.
+    const char* programs[] = {
+      "(letlambdas (((current-let x) 1)) (current-let nope))",
+      "(letlambdas (((current-let x) 1)) (current-let (import core nope)))",
+    };
+    for(const char* program : programs) {
+      Value output = optimize(vm, vm.parse(program));
+      bool raised = false;
+      try {
+        eval(vm, output, vm.nil);
+      } catch(const VMError& error) {
+        raised = true;
+      }
+      EXPECT(raised);
+    }
+
+    // Bound variables are still substituted.
+    Value input = vm.parse("(letlambdas (((f y) (letlambdas (((current-let x) 1)) (current-let y)))) (f 2))");
+    OptimizeStats stats;
+    EXPECT_INT_EQ(1, optimize(vm, input, OptimizeOptions(), &stats).asInteger(vm));
+  }
+}
+
+void testEscape() {
+  VM vm;
+
+  Value lambda = eval(vm, vm.parse("(letlambdas (((f n) n)) f)"), vm.nil);
+  EXPECT(!lambda.asLambda(vm).frameEscapes);
+  lambda = eval(vm, vm.parse("(letlambdas (((f . items) items)) f)"), vm.nil);
+  EXPECT(lambda.asLambda(vm).frameEscapes);
+  lambda = eval(vm, vm.parse("(letlambdas (((f n) (letlambdas (((g) n)) g))) f)"), vm.nil);
+  EXPECT(lambda.asLambda(vm).frameEscapes);
+
+  // The closure returned by make-adder keeps its frame; the one it makes
+  // doesn't need to.
+  Value input = vm.parse(
+    "(letlambdas (((make-adder x) (letlambdas (((current-lambda y) ((import core +) x y))) current-lambda))) "
+    "  ((make-adder 1) 2))");
+  EXPECT_INT_EQ(3, eval(vm, input, vm.nil).asInteger(vm));
+
+  // A tail-recursive loop reuses the same scratch storage on every call.
+  input = vm.parse(
+    "(letlambdas (((loop n acc) "
+    "    (if ((import core eq?) n 0) acc "
+    "      (loop ((import core -) n 1) ((import core +) acc n))))) "
+    "  (loop 10000 0))");
+  EXPECT_INT_EQ(50005000, eval(vm, input, vm.nil).asInteger(vm));
+  EXPECT_INT_EQ(0, (int)vm.scratchInUse());
+}
+
+void testFlatClosures() {
+  VM vm;
+
+  // Only `a` is captured, not `b`, `c` or the name of `outer` itself.
+  Value closure = eval(vm, vm.parse(
+    "(letlambdas (((outer a b c) (letlambdas (((current-lambda x) ((import core +) x a))) current-lambda))) "
+    "  (outer 1 2 3))"), vm.nil);
+  EXPECT_INT_EQ(1, (int)list_length(closure.asLambda(vm).env));
+  EXPECT_INT_EQ(11, apply(vm, closure, vm.makeList(vm.makeInteger(10))).asInteger(vm));
+
+  // Closures defined together capture each other.
+  Value input = vm.parse(
+    "(letlambdas (((parity n) "
+    "    (letlambdas (((even? k) (if ((import core eq?) k 0) #t (odd? ((import core -) k 1)))) "
+    "                 ((odd? k) (if ((import core eq?) k 0) #f (even? ((import core -) k 1))))) "
+    "      (even? n)))) "
+    "  (parity 7))");
+  EXPECT(!eval(vm, input, vm.nil).asBool(vm));
+}
+
+void testArguments() {
+  VM vm;
+
+  // Only a rest parameter turns the arguments into a list.
+  Value list = eval(vm, vm.parse(
+    "(letlambdas (((list . items) items)) (list 1 2 3))"), vm.nil);
+  EXPECT(list == vm.makeList(vm.makeInteger(1), vm.makeInteger(2), vm.makeInteger(3)));
+  Value tail = eval(vm, vm.parse(
+    "(letlambdas (((tail a . rest) rest)) (tail 1))"), vm.nil);
+  EXPECT(tail.isNil());
+
+  // More arguments than fit in the inline buffer, and a dotted call.
+  Value sum = eval(vm, vm.parse(
+    "((import core +) 1 2 3 4 5 6 7 8 9 10)"), vm.nil);
+  EXPECT_INT_EQ(55, sum.asInteger(vm));
+  Value spread = eval(vm, vm.parse(
+    "(letlambdas (((f . xs) ((import core +) 1 . xs))) (f 2 3))"), vm.nil);
+  EXPECT_INT_EQ(6, spread.asInteger(vm));
+
+  Value add = eval(vm, vm.parse("(import core +)"), vm.nil);
+  Value args[] = { vm.makeInteger(4), vm.makeInteger(5) };
+  EXPECT_INT_EQ(9, apply(vm, add, args, 2).asInteger(vm));
+  Value pair = eval(vm, vm.parse(
+    "(letlambdas (((pair a b) ((import core cons) b a))) pair)"), vm.nil);
+  EXPECT(apply(vm, pair, args, 2) == vm.makeCons(vm.makeInteger(5), vm.makeInteger(4)));
+}
+
+static int64_t scale(int64_t a, unsigned b) {
+  return a * b;
+}
+
+static String first_word(String str) {
+  return str.substr(0, text_break(str, 0, String(" ")));
+}
+
+static void ignore(Value value) {}
+
+void testBind() {
+  VM vm;
+
+  Value args[] = { vm.makeInteger(6), vm.makeInteger(7) };
+  EXPECT_INT_EQ(42, BIND_BUILTIN(scale)(vm, args, 2).asInteger(vm));
+
+  Value words = vm.makeString(String("hello there"));
+  Value word = BIND_BUILTIN(first_word)(vm, &words, 1);
+  EXPECT(word == vm.makeString(String("hello")));
+
+  Value builtin = make_builtin(vm, "scale", BIND_BUILTIN(scale));
+  EXPECT_INT_EQ(-12, apply(vm, builtin, vm.makeList(vm.makeInteger(-3), vm.makeInteger(4))).asInteger(vm));
+
+  EXPECT(BIND_BUILTIN(ignore)(vm, args, 1).isNil());
+}
+
+void testNativeModule() {
+  VM vm;
+
+  Value module = eval(vm, vm.makeList(vm.objs.builtin_load_module,
+    vm.makeList(vm.syms.quote, vm.makeSymbol("native/build/test/native/ext"))), vm.nil);
+  Value fib = apply(vm, module, vm.makeList(vm.makeSymbol("fib")));
+  EXPECT_INT_EQ(55, apply(vm, fib, vm.makeList(vm.makeInteger(10))).asInteger(vm));
+
+  // Loaded once, then found by name.
+  Value again = eval(vm, vm.makeList(vm.objs.builtin_load_module,
+    vm.makeList(vm.syms.quote, vm.makeSymbol("native/build/test/native/ext"))), vm.nil);
+  EXPECT(module == again);
+
+  Value longer = apply(vm, module, vm.makeList(vm.makeSymbol("longer?")));
+  EXPECT(apply(vm, longer, vm.makeList(vm.makeString(String("abc")), vm.makeString(String("de")))).asBool(vm));
+
+  // The loader's reason is part of the error.
+  std::string message;
+  try {
+    load_native_module(vm, vm.makeSymbol("native/build/test/native/missing"));
+  } catch(const VMError& error) {
+    message = error.message;
+  }
+  EXPECT(message.find("can't load native module: ") == 0 && message.find("missing.so") != std::string::npos);
+}
+
+static Value load_tostring(VM& vm, const char* module) {
+  Value loaded = eval(vm, vm.makeList(vm.objs.builtin_load_module,
+    vm.makeList(vm.syms.quote, vm.makeSymbol(module))), vm.nil);
+  return apply(vm, loaded, vm.makeList(vm.makeSymbol("tostring")));
+}
+
+void testCompiledModule() {
+  VM vm;
+
+  // The compiled prettyprinter prints like the interpreted one.
+  Value compiled = load_tostring(vm, "native/build/test/native/prettyprint");
+  Value interpreted = load_tostring(vm, "lang/prettyprint");
+  EXPECT(compiled.isCompiled());
+  const char* values[] = {"42", "\"a\\\"b\\n\"", "(1 (2 . 3) #t)", "#(1 2)", "(quote (a b))"};
+  for(const char* source : values) {
+    Value value = vm.parse(source);
+    EXPECT(apply(vm, compiled, vm.makeList(value)) == apply(vm, interpreted, vm.makeList(value)));
+  }
+
+  std::string message;
+  try {
+    compiled_unbound(vm, "nope");
+  } catch(const VMError& error) {
+    message = error.message;
+  }
+  EXPECT(message == "unbound variable nope");
+}
+
+void testMacroexpand() {
+  VM vm;
+
+  // (twice x) => (x x)
+  Value twice = eval(vm, vm.parse(
+    "(letlambdas (((twice form) ((import core cons) ((import core first) ((import core rest) form)) "
+    "  ((import core rest) form)))) twice)"), vm.nil);
+  Value macros = hashmap_assoc(vm, make_hashmap(vm), vm.makeSymbol("twice"), twice);
+
+  Value program = vm.parse("(a (b c) (twice d) (e f) . g)");
+  Value expanded = macroexpand(vm, program, macros);
+  EXPECT(expanded == vm.parse("(a (b c) (d d) (e f) . g)"));
+
+  // Unchanged subtrees are shared.
+  Value cell = program;
+  Value expandedCell = expanded;
+  for(size_t i = 0; i < 4; i++) {
+    bool shared = cell.asCons(vm).first.getObj() == expandedCell.asCons(vm).first.getObj();
+    EXPECT(shared == (i != 2));
+    cell = cell.asCons(vm).rest;
+    expandedCell = expandedCell.asCons(vm).rest;
+  }
+  EXPECT(macroexpand(vm, program, make_hashmap(vm)).getObj() == program.getObj());
+
+  // Expansions are expanded again, and quoted forms are expanded too.
+  EXPECT(macroexpand(vm, vm.parse("(twice (twice d))"), macros) == vm.parse("((d d) (d d))"));
+  EXPECT(macroexpand(vm, vm.parse("(quote (twice d))"), macros) == vm.parse("(quote (d d))"));
+}
+
+void testServer() {
+  const char* path = "build/test/server.sock";
+  unlink(path);
+  pid_t server = fork();
+  if(server == 0) {
+    VM vm;
+    ServerOptions options;
+    options.workers = 2;
+    serve(vm, path, options);
+    _exit(1);
+  }
+  while(access(path, F_OK) != 0) {
+    usleep(1000);
+  }
+
+  std::string output;
+  EXPECT(server_request(path, RequestKind::Expression, String("((import core +) 1 2)"), output));
+  EXPECT(output == "3\n");
+
+  // A failed request gets the error back, and its worker is reset and
+  // goes on serving.
+  EXPECT(!server_request(path, RequestKind::Expression, String("((import core +) 1 (quote a))"), output));
+  EXPECT(output.find("error occurred") != std::string::npos);
+  for(int i = 0; i < 5; i++) {
+    EXPECT(server_request(path, RequestKind::Expression, String("((import core +) 2 2)"), output));
+    EXPECT(output == "4\n");
+  }
+
+  // A failing actor's error fails the request that waits on it, without
+  // taking down the worker.
+  const char* failing =
+    "(letlambdas (((run) ((import core +) 1 (quote a))) ((wait id) ((import core receive)))) "
+    "  (wait ((import core spawn) run)))";
+  EXPECT(!server_request(path, RequestKind::Expression, String(failing), output));
+  EXPECT(output.find("actor 1 failed: ") != std::string::npos);
+
+  // Workers whose requests leave an actor waiting are replaced instead of
+  // waiting for it, so more such requests than workers still get served.
+  const char* waiting = "((import core spawn) (letlambdas (((wait) ((import core receive)))) wait))";
+  for(int i = 0; i < 3; i++) {
+    EXPECT(server_request(path, RequestKind::Expression, String(waiting), output));
+  }
+  EXPECT(server_request(path, RequestKind::Expression, String("((import core +) 2 2)"), output));
+  EXPECT(output == "4\n");
+
+  const char* script =
+    "(module (import core (*)) (define (square x) (* x x)) (define (main) (square 12)) (export main))";
+  EXPECT(server_request(path, RequestKind::Script, String(script), output));
+  EXPECT(output == "144\n");
+
+  kill(server, SIGTERM);
+  waitpid(server, 0, 0);
+  unlink(path);
+}
+
+void testFormReader() {
+  VM vm;
+
+  const char* source =
+    "; comment\n"
+    "(a (b \"c)\\\"\" ; d)\n e))\n"
+    "  'x '(y z) 42\"s\" #t\n"
+    "(unclosed";
+  const char* expected[] = {"(a (b \"c)\\\"\" ; d)\n e))", "'x", "'(y z)", "42", "\"s\"", "#t", "(unclosed"};
+  FormReader reader{String(source)};
+  String form;
+  for(const char* e : expected) {
+    EXPECT(reader.next(form));
+    EXPECT(form == String(e));
+  }
+  EXPECT(!reader.next(form));
+
+  EXPECT(vm.parse(String(expected[0])) == vm.parse("(a (b \"c)\\\"\" e))"));
+
+  const char* path = "build/test/forms.ss";
+  FILE* f = fopen(path, "wb");
+  fputs(source, f);
+  fclose(f);
+  {
+    MappedFile mapped(path);
+    EXPECT(String(mapped.data, mapped.length) == String(source));
+  }
+  EXPECT(MappedFile("build/test/missing.ss").data == 0);
+  unlink(path);
+}
+
+static Value call_builtin(VM& vm, BuiltinFunc func, std::initializer_list<Value> args) {
+  return func(vm, args.begin(), args.size());
+}
+
+void testPorts() {
+  VM vm;
+  const char* path = "build/test/port.txt";
+  std::string longLine(100, 'x');
+
+  // A 16 byte buffer, so that most writes go out through writev.
+  Value out = call_builtin(vm, builtin_open_output_file, {vm.makeString(String(path)), vm.makeInteger(16)});
+  EXPECT(call_builtin(vm, builtin_constructor, {out}) == vm.syms.Port);
+  const char* writes[] = {"one\n", "two", "\n", longLine.c_str(), "\nlast"};
+  for(const char* w : writes) {
+    call_builtin(vm, builtin_write_string, {out, vm.makeString(String(w))});
+  }
+  call_builtin(vm, builtin_close_port, {out});
+
+  Value in = call_builtin(vm, builtin_open_input_file, {vm.makeString(String(path)), vm.makeInteger(8)});
+  const char* lines[] = {"one", "two", longLine.c_str(), "last"};
+  for(const char* line : lines) {
+    EXPECT(call_builtin(vm, builtin_read_line, {in}) == vm.makeString(String(line)));
+  }
+  EXPECT(call_builtin(vm, builtin_read_line, {in}).isNil());
+  EXPECT(call_builtin(vm, builtin_read_bytes, {in, vm.makeInteger(4)}).isNil());
+
+  in = call_builtin(vm, builtin_open_input_file, {vm.makeString(String(path)), vm.makeInteger(8)});
+  EXPECT(call_builtin(vm, builtin_read_bytes, {in, vm.makeInteger(2)}) == vm.makeString(String("on")));
+  Value rest = call_builtin(vm, builtin_read_bytes, {in, vm.makeInteger(1000)});
+  EXPECT(rest.asString(vm).length == 4 + 4 + 101 + 4 - 2);
+  EXPECT(call_builtin(vm, builtin_read_bytes, {in, vm.makeInteger(1)}).isNil());
+
+  // Asking for far more than the file holds only costs what was read.
+  in = call_builtin(vm, builtin_open_input_file, {vm.makeString(String(path)), vm.makeInteger(8)});
+  size_t used = vm.heapStats().used;
+  rest = call_builtin(vm, builtin_read_bytes, {in, vm.makeInteger(2000000000)});
+  EXPECT(rest.asString(vm).length == 4 + 4 + 101 + 4);
+  EXPECT(vm.heapStats().used < used + 64 * 1024);
+  unlink(path);
+
+  std::string message;
+  try {
+    call_builtin(vm, builtin_open_input_file, {vm.makeString(String(path))});
+  } catch(const VMError& error) {
+    message = error.message;
+  }
+  EXPECT(message == std::string("can't open ") + path + ": " + strerror(ENOENT));
+}
+
+void testHeap() {
+  VM vm;
+  HeapStats before = vm.heapStats();
+  EXPECT(before.used > 0 && before.used <= before.reserved);
+  EXPECT(vm.familyReserved() == before.reserved);
+
+  // Blocks double in size, so a million cells only take a few dozen.
+  Value list = vm.nil;
+  for(int i = 0; i < 1000000; i++) {
+    list = vm.makeCons(vm.makeInteger(i), list);
+  }
+  HeapStats after = vm.heapStats();
+  EXPECT(after.used >= before.used + 1000000 * (object_size(Object::Type::Cons) + object_size(Object::Type::Integer)));
+  EXPECT(after.blocks < before.blocks + 40);
+
+  // heap-stats gives sizes in KiB, which stay in range past 2 GB.
+  Value reported = call_builtin(vm, builtin_heap_stats, {});
+  Value reserved = reported->as_cons.rest->as_cons.first;
+  EXPECT(reserved->as_cons.first == vm.makeSymbol("reserved-kib"));
+  int kib = reserved->as_cons.rest.asInteger(vm);
+  EXPECT((size_t)kib >= after.reserved / 1024 && (size_t)kib <= vm.heapStats().reserved / 1024 + 1);
+
+  {
+    VM child(vm);
+    child.makeString(String("child"));
+    EXPECT(vm.familyReserved() == after.reserved + child.heapStats().reserved);
+  }
+  EXPECT(vm.familyReserved() == after.reserved);
+
+  // A long chain is freed without recursing.
+  heap_block_t* chain = 0;
+  for(int i = 0; i < 1000000; i++) {
+    chain = make_heap_block(64, chain);
+  }
+  free_heap_blocks(chain);
+
+  // Running past the limit is a VM error, after which a reset gets the
+  // memory back.
+  VM limited;
+  size_t limit = limited.familyReserved() + 1024 * 1024;
+  limited.setMemoryLimit(limit);
+  bool raised = false;
+  try {
+    for(int i = 0; i < 1000000; i++) {
+      limited.makeCons(limited.nil, limited.nil);
+    }
+  } catch(const VMError& error) {
+    raised = error.message == "memory limit exceeded";
+  }
+  EXPECT(raised);
+  limited.reset();
+  EXPECT(limited.familyReserved() < limit);
+  EXPECT(limited.makeCons(limited.nil, limited.nil).isCons());
+
+  // The same with hash-consing, whose cells are allocated under the shared
+  // lock, and a frame to trace.
+  VM consing;
+  consing.hashConsing = true;
+  consing.setMemoryLimit(consing.familyReserved() + 4 * 1024 * 1024);
+  raised = false;
+  try {
+    EvalFrame frame(consing, consing.makeSymbol("building"), consing.nil);
+    Value list = consing.nil;
+    for(int i = 0; i < 1000000; i++) {
+      list = consing.makeCons(consing.nil, list);
+    }
+  } catch(const VMError& error) {
+    raised = error.message == "memory limit exceeded" && error.trace.size() == 1;
+  }
+  EXPECT(raised);
+}
+
+void testRecover() {
+  VM vm;
+  Value bad = vm.transform(vm.parse("((import core +) 1 (quote a))"));
+  bool raised = false;
+  try {
+    eval(vm, bad, vm.nil);
+  } catch(const VMError& error) {
+    raised = true;
+    EXPECT(!error.assertion && !error.message.empty() && error.line > 0);
+    EXPECT(!error.trace.empty() && error.trace[0].find("evaluating ") == 0);
+  }
+  EXPECT(raised);
+  EXPECT(vm.currentEvalFrame == 0);
+  Value sum = vm.transform(vm.parse("((import core +) 1 2)"));
+  EXPECT(eval(vm, sum, vm.nil) == vm.makeInteger(3));
+
+  // What is allocated after the checkpoint is freed by a reset, but the
+  // boot modules stay loaded.
+  vm.loadBootModules();
+  vm.checkpoint();
+  size_t reserved = vm.familyReserved();
+  for(int i = 0; i < 100000; i++) {
+    vm.makeCons(vm.nil, vm.nil);
+  }
+  EXPECT(vm.familyReserved() > reserved);
+  vm.reset();
+  EXPECT(vm.familyReserved() <= reserved);
+  sum = vm.transform(vm.parse("((import core +) 1 2)"));
+  EXPECT(eval(vm, sum, vm.nil) == vm.makeInteger(3));
+
+  // An unknown module is an error like any other.
+  raised = false;
+  try {
+    vm.loadModule(vm.makeSymbol("no/such/module"));
+  } catch(const VMError& error) {
+    raised = error.message == "unrecognized module: no/such/module";
+  }
+  EXPECT(raised);
+
+  // Lists interned before the checkpoint are still shared by lists built
+  // after a reset.
+  VM consing;
+  consing.hashConsing = true;
+  Value kept = consing.makeList(consing.makeInteger(1), consing.makeInteger(2));
+  consing.checkpoint();
+  EXPECT(consing.makeList(consing.makeInteger(1), consing.makeInteger(2)).getObj() == kept.getObj());
+  consing.reset();
+  Value rebuilt = consing.makeList(consing.makeInteger(1), consing.makeInteger(2));
+  EXPECT(rebuilt == kept);
+  EXPECT(rebuilt.getObj() == kept.getObj());
+}
+
+// Whether every cell of `list` is followed in memory by the next one,
+// except at page boundaries.
+static bool is_contiguous(Value list) {
+  size_t size = object_size(Object::Type::Cons);
+  for(; list.isCons() && list->as_cons.rest.isCons(); list = list->as_cons.rest) {
+    uintptr_t cell = (uintptr_t)list.getObj();
+    uintptr_t next = (uintptr_t)list->as_cons.rest.getObj();
+    if(next != cell + size && next % pageSize != pageHeaderSize) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void testContiguousList() {
+  VM vm;
+  std::vector<Value> items;
+  for(int i = 0; i < 1000; i++) {
+    items.push_back(vm.makeInteger(i));
+  }
+  Value list = vm.makeContiguousList(items.data(), items.size(), vm.nil);
+  EXPECT_INT_EQ(1000, (int)list_length(list));
+  EXPECT(is_contiguous(list));
+  Value built = vm.nil;
+  for(size_t i = items.size(); i > 0; i--) {
+    built = vm.makeCons(items[i - 1], built);
+  }
+  EXPECT(list == built);
+
+  Value dotted = vm.makeContiguousList(items.data(), 2, vm.makeInteger(7));
+  EXPECT(dotted->as_cons.rest->as_cons.rest == vm.makeInteger(7));
+  EXPECT(vm.makeContiguousList(items.data(), 0, vm.nil).isNil());
+
+  // Deserialized lists are laid out in runs, spine and elements alike, and
+  // a long spine doesn't recurse.
+  Value nested = vm.makeList(list, vm.makeSymbol("a"), vm.makeList(vm.makeString("b")));
+  Value copy = deserialize(vm, serialize(nested).text);
+  EXPECT(copy == nested);
+  EXPECT(is_contiguous(copy) && is_contiguous(copy->as_cons.first));
+
+  Value parsed = vm.parse("(a (b c d) e f)");
+  EXPECT(parsed == vm.makeList(vm.makeSymbol("a"),
+    vm.makeList(vm.makeSymbol("b"), vm.makeSymbol("c"), vm.makeSymbol("d")),
+    vm.makeSymbol("e"), vm.makeSymbol("f")));
+  EXPECT(is_contiguous(parsed) && is_contiguous(parsed->as_cons.rest->as_cons.first));
+}
+
+static int run_with_jit(JitMode mode, const char* program, JitStats& stats) {
+  VM vm;
+  Value code = vm.parse(program);
+  vm.jitMode = mode;
+  Value result = eval(vm, code, vm.nil);
+  stats = jit_stats(vm);
+  return result.isBool() ? -(int)result.asBoolUnsafe() : result.asInteger(vm);
+}
+
+void testJit() {
+  const char* fib =
+    "(letlambdas (((fib n) (if ((import core eq?) n 0) 0 (if ((import core eq?) n 1) 1 "
+    "    ((import core +) (fib ((import core -) n 1)) (fib ((import core -) n 2))))))) "
+    "  (fib 15))";
+  JitStats stats;
+  EXPECT_INT_EQ(610, run_with_jit(JitMode::Off, fib, stats));
+  EXPECT_INT_EQ(0, (int)stats.compiled);
+  EXPECT_INT_EQ(610, run_with_jit(JitMode::Always, fib, stats));
+  EXPECT_INT_EQ(1, (int)stats.compiled);
+  EXPECT_INT_EQ(1, (int)stats.nativeCalls);
+
+  // The loop is compiled once it gets hot, and its tail call runs in
+  // place from then on.
+  const char* loop =
+    "(letlambdas (((loop i acc) (if ((import core eq?) i 0) acc "
+    "    (loop ((import core -) i 1) ((import core modulo) ((import core +) ((import core *) acc 31) i) 1009))))) "
+    "  (loop 5000 7))";
+  int interpreted = run_with_jit(JitMode::Off, loop, stats);
+  EXPECT_INT_EQ(interpreted, run_with_jit(JitMode::On, loop, stats));
+  EXPECT_INT_EQ(1, (int)stats.compiled);
+
+  const char* parity =
+    "(letlambdas (((even? n) (if ((import core eq?) n 0) #t (if ((import core eq?) n 1) #f "
+    "    (even? ((import core -) n 2)))))) "
+    "  (even? 11))";
+  EXPECT_INT_EQ(0, run_with_jit(JitMode::Always, parity, stats));
+  EXPECT_INT_EQ(1, (int)stats.compiled);
+
+  // Arguments that aren't integers fail the guard and get interpreted.
+  const char* same =
+    "(letlambdas (((same? a b) ((import core eq?) a b))) (if (same? 1 1) (same? \"x\" \"x\") #f))";
+  EXPECT_INT_EQ(-1, run_with_jit(JitMode::Always, same, stats));
+  EXPECT_INT_EQ(1, (int)stats.guardFailures);
+
+  // Bodies outside the compiled subset stay interpreted.
+  const char* pair =
+    "(letlambdas (((pair a) ((import core cons) a a))) ((import core first) (pair 3)))";
+  EXPECT_INT_EQ(3, run_with_jit(JitMode::Always, pair, stats));
+  EXPECT_INT_EQ(1, (int)stats.rejected);
+
+  // Divisors idiv would trap on are handed back to the builtins.
+  const char* divide =
+    "(letlambdas (((div a b) ((import core /) a b)) ((mod a b) ((import core modulo) a b))) "
+    "  (if ((import core eq?) (mod 7 ((import core -) 0 1)) 0) "
+    "    (div ((import core -) 0 2147483647 1) ((import core -) 0 1)) 1))";
+  EXPECT_INT_EQ(INT_MIN, run_with_jit(JitMode::Always, divide, stats));
+  EXPECT_INT_EQ(2, (int)stats.bailouts);
+  bool raised = false;
+  try {
+    run_with_jit(JitMode::Always, "(letlambdas (((div a b) ((import core /) a b))) (div 7 0))", stats);
+  } catch(const VMError& error) {
+    raised = error.message == "division by zero";
+  }
+  EXPECT(raised);
+}
+
 void testAll() {
   testMakeList();
   testSymbols();
@@ -244,9 +1290,39 @@ void testAll() {
   testParseAndEval();
   testSerialize();
   testInterpret();
+  testParallel();
+  testActors();
+  testVector();
+  testHashMap();
+  testArray();
+  testText();
+  testConcat();
+  testStringStorage();
+  testHashCons();
+  testMemoize();
+  testOptimize();
+  testEscape();
+  testFlatClosures();
+  testArguments();
+  testBind();
+  testNativeModule();
+  testCompiledModule();
+  testMacroexpand();
+  testServer();
+  testFormReader();
+  testPorts();
+  testHeap();
+  testRecover();
+  testContiguousList();
+  testJit();
 }
 
 int main(int argc, char** argv) {
-  testAll();
+  try {
+    testAll();
+  } catch(const VMError& error) {
+    error.print(stderr);
+    return 1;
+  }
   return 0;
 }
\ No newline at end of file